@@ -0,0 +1,329 @@
+/*
+ * Shared input layer for the C benchmark programs.
+ *
+ * BENCH_IO selects how stdin is slurped:
+ *   BENCH_IO_STDIO  getchar() loop with doubling realloc (the historical
+ *                   "naive" baseline, and the default)
+ *   BENCH_IO_READ   fstat-sized preallocation plus large read(2) chunks
+ *   BENCH_IO_MMAP   like BENCH_IO_READ, but maps stdin when it is a
+ *                   regular file
+ *
+ * run_benchmarks.py builds the stdio variant as "C" and the mmap variant
+ * as "C-io" (see --c-io). The *_stream.c programs bypass bench_input and
+ * pull fixed-size chunks with bench_read_chunk() instead; the *_par.c
+ * programs split the buffered input across bench_thread_count() workers.
+ *
+ * The primary programs are written as a bench_kernel run by bench_main(),
+ * which times only the kernel call. With BENCH_KERNEL_TIMING set in the
+ * environment it reports that time on stderr as "BENCH_KERNEL_NS <ns>".
+ * With BENCH_SERVE set it instead answers a stream of requests in one
+ * process (see bench_serve()). regex_replace_zc.c is the exception: it
+ * writes spans of the input straight to stdout with writev(2), which a
+ * bench_output would have to copy, so it reports no kernel time and has
+ * no server mode.
+ */
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#define BENCH_IO_STDIO 0
+#define BENCH_IO_READ 1
+#define BENCH_IO_MMAP 2
+
+#ifndef BENCH_IO
+#define BENCH_IO BENCH_IO_STDIO
+#endif
+
+#define BENCH_READ_CHUNK (1u << 20)
+
+/* Buffer size used by the constant-memory *_stream.c programs. */
+#define BENCH_STREAM_CHUNK (64u * 1024u)
+
+typedef struct {
+    const uint8_t *data;
+    size_t len;
+    uint8_t *heap;      /* owned malloc buffer, or NULL */
+    size_t mapped_len;  /* length of the mapping, or 0 */
+} bench_input;
+
+static inline int bench_read_stdio(bench_input *in) {
+    uint8_t *buf = NULL;
+    size_t capacity = 0;
+    size_t len = 0;
+
+    int c;
+    while ((c = getchar()) != EOF) {
+        if (len >= capacity) {
+            capacity = capacity ? capacity * 2 : 4096;
+            buf = realloc(buf, capacity);
+            if (!buf) return -1;
+        }
+        buf[len++] = (uint8_t)c;
+    }
+
+    in->data = buf;
+    in->len = len;
+    in->heap = buf;
+    in->mapped_len = 0;
+    return 0;
+}
+
+static inline int bench_read_fd(bench_input *in, int fd, size_t size_hint) {
+    size_t capacity = size_hint ? size_hint + 1 : BENCH_READ_CHUNK;
+    size_t len = 0;
+    uint8_t *buf = malloc(capacity);
+    if (!buf) return -1;
+
+    for (;;) {
+        if (len == capacity) {
+            capacity *= 2;
+            uint8_t *grown = realloc(buf, capacity);
+            if (!grown) {
+                free(buf);
+                return -1;
+            }
+            buf = grown;
+        }
+        size_t want = capacity - len;
+        if (want > 64 * (size_t)BENCH_READ_CHUNK) want = 64 * (size_t)BENCH_READ_CHUNK;
+        ssize_t n = read(fd, buf + len, want);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            free(buf);
+            return -1;
+        }
+        if (n == 0) break;
+        len += (size_t)n;
+    }
+
+    in->data = buf;
+    in->len = len;
+    in->heap = buf;
+    in->mapped_len = 0;
+    return 0;
+}
+
+/* Reads all of stdin into `in`. Returns 0 on success. */
+static inline int bench_read_input(bench_input *in) {
+    if (BENCH_IO == BENCH_IO_STDIO) {
+        return bench_read_stdio(in);
+    }
+
+    size_t size_hint = 0;
+    struct stat st;
+    if (fstat(STDIN_FILENO, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+        off_t pos = lseek(STDIN_FILENO, 0, SEEK_CUR);
+        if (pos >= 0 && pos < st.st_size) {
+            size_hint = (size_t)(st.st_size - pos);
+        }
+        if (BENCH_IO == BENCH_IO_MMAP && pos == 0) {
+            /* MAP_PRIVATE keeps the mapping writable without touching the file. */
+            void *p = mmap(NULL, (size_t)st.st_size, PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE, STDIN_FILENO, 0);
+            if (p != MAP_FAILED) {
+#ifdef MADV_SEQUENTIAL
+                madvise(p, (size_t)st.st_size, MADV_SEQUENTIAL);
+#endif
+                in->data = p;
+                in->len = (size_t)st.st_size;
+                in->heap = NULL;
+                in->mapped_len = (size_t)st.st_size;
+                return 0;
+            }
+        }
+    }
+
+    return bench_read_fd(in, STDIN_FILENO, size_hint);
+}
+
+static inline void bench_free_input(bench_input *in) {
+    if (in->mapped_len) {
+        munmap((void *)in->data, in->mapped_len);
+    }
+    free(in->heap);
+    in->data = NULL;
+    in->len = 0;
+    in->heap = NULL;
+    in->mapped_len = 0;
+}
+
+/*
+ * Reads the next chunk of stdin for the streaming programs.
+ * Returns the number of bytes read, 0 at EOF, or -1 on error.
+ */
+static inline ssize_t bench_read_chunk(uint8_t *buf, size_t cap) {
+    for (;;) {
+        ssize_t n = read(STDIN_FILENO, buf, cap);
+        if (n >= 0 || errno != EINTR) return n;
+    }
+}
+
+/*
+ * Worker count for the *_par.c programs: argv[1], clamped to [1, 256].
+ * Defaults to 1 so the binaries also run standalone.
+ */
+static inline int bench_thread_count(int argc, char **argv) {
+    if (argc < 2) return 1;
+    long n = strtol(argv[1], NULL, 10);
+    if (n < 1) return 1;
+    if (n > 256) return 256;
+    return (int)n;
+}
+
+/* Start offset of chunk k when splitting len bytes into n nearly equal chunks. */
+static inline size_t bench_chunk_start(size_t len, int n, int k) {
+    size_t q = len / (size_t)n;
+    size_t r = len % (size_t)n;
+    return q * (size_t)k + r * (size_t)k / (size_t)n;
+}
+
+/* Growable output buffer a kernel appends its result to. */
+typedef struct {
+    uint8_t *data;
+    size_t len;
+    size_t cap;
+} bench_output;
+
+/* Makes room for at least `extra` more bytes. Returns 0 on success. */
+static inline int bench_output_reserve(bench_output *out, size_t extra) {
+    if (out->cap - out->len >= extra) return 0;
+    size_t cap = out->cap ? out->cap : 4096;
+    while (cap - out->len < extra) cap *= 2;
+    uint8_t *grown = realloc(out->data, cap);
+    if (!grown) return -1;
+    out->data = grown;
+    out->cap = cap;
+    return 0;
+}
+
+static inline int bench_output_write(bench_output *out, const void *p, size_t n) {
+    if (bench_output_reserve(out, n) != 0) return -1;
+    memcpy(out->data + out->len, p, n);
+    out->len += n;
+    return 0;
+}
+
+/* Appends v in host byte order, matching fwrite(&v, 4, 1, stdout). */
+static inline int bench_output_u32(bench_output *out, uint32_t v) {
+    return bench_output_write(out, &v, sizeof v);
+}
+
+/* Turns one input into its output. Returns 0 on success. */
+typedef int (*bench_kernel)(const uint8_t *input, size_t len, bench_output *out);
+
+static inline uint64_t bench_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+static inline void bench_report_kernel_ns(uint64_t ns) {
+    if (getenv("BENCH_KERNEL_TIMING")) {
+        fprintf(stderr, "BENCH_KERNEL_NS %llu\n", (unsigned long long)ns);
+    }
+}
+
+/* Reads exactly n bytes from stdin. Returns 1 on success, 0 on clean EOF, -1 on error. */
+static inline int bench_read_exact(uint8_t *buf, size_t n) {
+    size_t got = 0;
+    while (got < n) {
+        ssize_t r = bench_read_chunk(buf + got, n - got);
+        if (r < 0) return -1;
+        if (r == 0) return got == 0 ? 0 : -1;
+        got += (size_t)r;
+    }
+    return 1;
+}
+
+/*
+ * Request loop for server mode. Each request and response is a u32 LE
+ * byte length followed by that many bytes (the X07 direct-binary ABI).
+ * The request and output buffers are reused across requests, so the
+ * kernel runs against a warm heap.
+ */
+static inline int bench_serve(bench_kernel kernel) {
+    uint8_t *req = NULL;
+    size_t req_cap = 0;
+    bench_output out = {0};
+    int rc = 0;
+
+    for (;;) {
+        uint8_t hdr[4];
+        int got = bench_read_exact(hdr, sizeof hdr);
+        if (got <= 0) {
+            rc = got < 0;
+            break;
+        }
+        size_t len = (size_t)hdr[0] | (size_t)hdr[1] << 8 | (size_t)hdr[2] << 16 |
+                     (size_t)hdr[3] << 24;
+        if (len > req_cap) {
+            uint8_t *grown = realloc(req, len);
+            if (!grown) {
+                rc = 1;
+                break;
+            }
+            req = grown;
+            req_cap = len;
+        }
+        if (len > 0 && bench_read_exact(req, len) != 1) {
+            rc = 1;
+            break;
+        }
+
+        out.len = 0;
+        if (kernel(req, len, &out) != 0) {
+            rc = 1;
+            break;
+        }
+        uint32_t out_len = (uint32_t)out.len;
+        uint8_t resp_hdr[4] = {(uint8_t)out_len, (uint8_t)(out_len >> 8),
+                               (uint8_t)(out_len >> 16), (uint8_t)(out_len >> 24)};
+        if (fwrite(resp_hdr, 1, 4, stdout) != 4 ||
+            (out.len > 0 && fwrite(out.data, 1, out.len, stdout) != out.len) ||
+            fflush(stdout) != 0) {
+            rc = 1;
+            break;
+        }
+    }
+
+    free(out.data);
+    free(req);
+    return rc;
+}
+
+/* Reads stdin, runs the kernel once, writes its output to stdout. */
+static inline int bench_main(bench_kernel kernel) {
+    if (getenv("BENCH_SERVE")) {
+        return bench_serve(kernel);
+    }
+
+    bench_input in;
+    if (bench_read_input(&in) != 0) {
+        return 1;
+    }
+    bench_output out = {0};
+
+    uint64_t start = bench_now_ns();
+    int rc = kernel(in.data, in.len, &out);
+    uint64_t elapsed = bench_now_ns() - start;
+
+    if (rc == 0 && out.len > 0 && fwrite(out.data, 1, out.len, stdout) != out.len) {
+        rc = 1;
+    }
+    bench_report_kernel_ns(elapsed);
+
+    free(out.data);
+    bench_free_input(&in);
+    return rc == 0 ? 0 : 1;
+}
+
+#endif
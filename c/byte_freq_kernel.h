@@ -0,0 +1,35 @@
+/*
+ * The byte_freq kernel, shared by byte_freq.c and pipeline.c: (byte, u32 LE
+ * count) for every byte value that occurs.
+ */
+#ifndef BYTE_FREQ_KERNEL_H
+#define BYTE_FREQ_KERNEL_H
+
+#include <stdint.h>
+
+#include "bench.h"
+
+static int byte_freq_kernel(const uint8_t *input, size_t len, bench_output *out) {
+    uint32_t freq[256] = {0};
+
+    for (size_t i = 0; i < len; i++) {
+        freq[input[i]]++;
+    }
+
+    uint8_t output[256 * 5];
+    size_t out_len = 0;
+
+    for (int j = 0; j < 256; j++) {
+        if (freq[j] > 0) {
+            output[out_len++] = (uint8_t)j;
+            output[out_len++] = (uint8_t)(freq[j] & 0xFF);
+            output[out_len++] = (uint8_t)((freq[j] >> 8) & 0xFF);
+            output[out_len++] = (uint8_t)((freq[j] >> 16) & 0xFF);
+            output[out_len++] = (uint8_t)((freq[j] >> 24) & 0xFF);
+        }
+    }
+
+    return bench_output_write(out, output, out_len);
+}
+
+#endif
@@ -0,0 +1,72 @@
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bench.h"
+
+typedef struct {
+    const uint8_t *p;
+    size_t len;
+    uint32_t freq[256];
+} freq_task;
+
+static void *freq_worker(void *arg) {
+    freq_task *t = arg;
+    for (size_t i = 0; i < t->len; i++) {
+        t->freq[t->p[i]]++;
+    }
+    return NULL;
+}
+
+int main(int argc, char **argv) {
+    int threads = bench_thread_count(argc, argv);
+
+    bench_input in;
+    if (bench_read_input(&in) != 0) {
+        return 1;
+    }
+
+    pthread_t tid[256];
+    /* Heap-allocated so per-thread tables don't share cache lines with the stack. */
+    freq_task *task = calloc((size_t)threads, sizeof(freq_task));
+    if (!task) {
+        return 1;
+    }
+    for (int k = 0; k < threads; k++) {
+        size_t start = bench_chunk_start(in.len, threads, k);
+        size_t end = bench_chunk_start(in.len, threads, k + 1);
+        task[k].p = in.data + start;
+        task[k].len = end - start;
+        if (pthread_create(&tid[k], NULL, freq_worker, &task[k]) != 0) {
+            return 1;
+        }
+    }
+
+    uint32_t freq[256] = {0};
+    for (int k = 0; k < threads; k++) {
+        pthread_join(tid[k], NULL);
+        for (int j = 0; j < 256; j++) {
+            freq[j] += task[k].freq[j];
+        }
+    }
+
+    uint8_t output[256 * 5];
+    size_t out_len = 0;
+
+    for (int j = 0; j < 256; j++) {
+        if (freq[j] > 0) {
+            output[out_len++] = (uint8_t)j;
+            output[out_len++] = (uint8_t)(freq[j] & 0xFF);
+            output[out_len++] = (uint8_t)((freq[j] >> 8) & 0xFF);
+            output[out_len++] = (uint8_t)((freq[j] >> 16) & 0xFF);
+            output[out_len++] = (uint8_t)((freq[j] >> 24) & 0xFF);
+        }
+    }
+
+    fwrite(output, 1, out_len, stdout);
+
+    free(task);
+    bench_free_input(&in);
+    return 0;
+}
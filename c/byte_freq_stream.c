@@ -0,0 +1,35 @@
+#include <stdint.h>
+#include <stdio.h>
+
+#include "bench.h"
+
+int main(void) {
+    static uint8_t buf[BENCH_STREAM_CHUNK];
+    uint32_t freq[256] = {0};
+
+    ssize_t n;
+    while ((n = bench_read_chunk(buf, sizeof buf)) > 0) {
+        for (ssize_t i = 0; i < n; i++) {
+            freq[buf[i]]++;
+        }
+    }
+    if (n < 0) {
+        return 1;
+    }
+
+    uint8_t output[256 * 5];
+    size_t out_len = 0;
+
+    for (int j = 0; j < 256; j++) {
+        if (freq[j] > 0) {
+            output[out_len++] = (uint8_t)j;
+            output[out_len++] = (uint8_t)(freq[j] & 0xFF);
+            output[out_len++] = (uint8_t)((freq[j] >> 8) & 0xFF);
+            output[out_len++] = (uint8_t)((freq[j] >> 16) & 0xFF);
+            output[out_len++] = (uint8_t)((freq[j] >> 24) & 0xFF);
+        }
+    }
+
+    fwrite(output, 1, out_len, stdout);
+    return 0;
+}
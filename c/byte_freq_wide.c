@@ -0,0 +1,56 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+
+#define BANKS 4
+
+/*
+ * Output: for each byte value that occurs, the byte and its count as a
+ * u64 LE, so inputs past 4 GiB still count correctly.
+ *
+ * This is the reference for the byte_freq_wide cases: consecutive bytes go
+ * to independent tables, so a run of one byte value increments four
+ * counters in turn instead of waiting on one counter's store-to-load
+ * forwarding every iteration (see byte_freq_simd.c).
+ */
+static int kernel(const uint8_t *input, size_t len, bench_output *out) {
+    uint64_t bank[BANKS][256];
+    memset(bank, 0, sizeof bank);
+    size_t i = 0;
+
+    for (; i + 8 <= len; i += 8) {
+        uint64_t w;
+        memcpy(&w, input + i, sizeof w);
+        bank[0][(uint8_t)(w)]++;
+        bank[1][(uint8_t)(w >> 8)]++;
+        bank[2][(uint8_t)(w >> 16)]++;
+        bank[3][(uint8_t)(w >> 24)]++;
+        bank[0][(uint8_t)(w >> 32)]++;
+        bank[1][(uint8_t)(w >> 40)]++;
+        bank[2][(uint8_t)(w >> 48)]++;
+        bank[3][(uint8_t)(w >> 56)]++;
+    }
+    for (; i < len; i++) {
+        bank[0][input[i]]++;
+    }
+
+    uint8_t output[256 * 9];
+    size_t out_len = 0;
+
+    for (int j = 0; j < 256; j++) {
+        uint64_t n = bank[0][j] + bank[1][j] + bank[2][j] + bank[3][j];
+        if (n > 0) {
+            output[out_len++] = (uint8_t)j;
+            for (int k = 0; k < 8; k++) {
+                output[out_len++] = (uint8_t)(n >> (8 * k));
+            }
+        }
+    }
+
+    return bench_output_write(out, output, out_len);
+}
+
+int main(void) { return bench_main(kernel); }
@@ -0,0 +1,126 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+
+/* Little-endian base 2^32 limbs with no leading zero limbs; n == 0 is zero. */
+typedef struct {
+    uint32_t *d;
+    size_t n;
+} big;
+
+static void big_trim(big *x) {
+    while (x->n > 0 && x->d[x->n - 1] == 0) x->n--;
+}
+
+/* r = x + y. r may alias x or y. */
+static void big_add(big *r, const big *x, const big *y) {
+    size_t n = x->n > y->n ? x->n : y->n;
+    uint64_t carry = 0;
+    for (size_t i = 0; i < n; i++) {
+        uint64_t s = carry;
+        if (i < x->n) s += x->d[i];
+        if (i < y->n) s += y->d[i];
+        r->d[i] = (uint32_t)s;
+        carry = s >> 32;
+    }
+    r->d[n] = (uint32_t)carry;
+    r->n = n + 1;
+    big_trim(r);
+}
+
+/* r = x - y for x >= y. r may alias x. */
+static void big_sub(big *r, const big *x, const big *y) {
+    uint64_t borrow = 0;
+    for (size_t i = 0; i < x->n; i++) {
+        uint64_t s = (uint64_t)x->d[i] - (i < y->n ? y->d[i] : 0) - borrow;
+        r->d[i] = (uint32_t)s;
+        borrow = s >> 63;
+    }
+    r->n = x->n;
+    big_trim(r);
+}
+
+/* r = x * y, schoolbook. r must not alias x or y. */
+static void big_mul(big *r, const big *x, const big *y) {
+    memset(r->d, 0, (x->n + y->n) * sizeof *r->d);
+    for (size_t i = 0; i < x->n; i++) {
+        uint64_t xi = x->d[i];
+        uint64_t carry = 0;
+        for (size_t j = 0; j < y->n; j++) {
+            uint64_t t = r->d[i + j] + xi * y->d[j] + carry;
+            r->d[i + j] = (uint32_t)t;
+            carry = t >> 32;
+        }
+        r->d[i + y->n] = (uint32_t)carry;
+    }
+    r->n = x->n + y->n;
+    big_trim(r);
+}
+
+static void big_swap(big *x, big *y) {
+    big t = *x;
+    *x = *y;
+    *y = t;
+}
+
+/*
+ * Input: u32 LE n. Output: F(n) as a minimal little-endian byte string
+ * (empty for F(0)).
+ *
+ * Fast doubling from the top bit down, with (a, b) = (F(k), F(k+1)):
+ *   F(2k)   = F(k) * (2 F(k+1) - F(k))
+ *   F(2k+1) = F(k)^2 + F(k+1)^2
+ * so the time is in the last few schoolbook multiplies of ~0.69 n bits.
+ */
+static int kernel(const uint8_t *input, size_t len, bench_output *out) {
+    uint32_t n;
+    if (len < sizeof n) {
+        return 1;
+    }
+    memcpy(&n, input, sizeof n);
+
+    /* F(n+1) < 2^(0.695 (n+1)), plus room for the unnormalized products. */
+    size_t cap = (size_t)n / 45 + 4;
+    uint32_t *pool = malloc(6 * cap * sizeof *pool);
+    if (!pool) {
+        return 1;
+    }
+    big a = {pool, 0}, b = {pool + cap, 1}, t = {pool + 2 * cap, 0};
+    big c = {pool + 3 * cap, 0}, d = {pool + 4 * cap, 0}, e = {pool + 5 * cap, 0};
+    b.d[0] = 1;
+
+    for (int bit = 31; bit >= 0; bit--) {
+        big_add(&t, &b, &b);
+        big_sub(&t, &t, &a);
+        big_mul(&c, &a, &t);
+        big_mul(&d, &a, &a);
+        big_mul(&e, &b, &b);
+        big_add(&d, &d, &e);
+        if ((n >> bit) & 1) {
+            big_add(&c, &c, &d);
+            big_swap(&a, &d);
+            big_swap(&b, &c);
+        } else {
+            big_swap(&a, &c);
+            big_swap(&b, &d);
+        }
+    }
+
+    int rc = bench_output_reserve(out, a.n * 4);
+    if (rc == 0) {
+        for (size_t i = 0; i < a.n; i++) {
+            for (int k = 0; k < 4; k++) {
+                out->data[out->len++] = (uint8_t)(a.d[i] >> (8 * k));
+            }
+        }
+        while (out->len > 0 && out->data[out->len - 1] == 0) out->len--;
+    }
+
+    free(pool);
+    return rc;
+}
+
+int main(void) { return bench_main(kernel); }
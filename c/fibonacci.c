@@ -1,11 +1,15 @@
 #include <stdint.h>
 #include <stdio.h>
+#include <string.h>
 
-int main(void) {
+#include "bench.h"
+
+static int kernel(const uint8_t *input, size_t len, bench_output *out) {
     uint32_t n;
-    if (fread(&n, sizeof(uint32_t), 1, stdin) != 1) {
+    if (len < sizeof n) {
         return 1;
     }
+    memcpy(&n, input, sizeof n);
 
     uint32_t result;
     if (n < 2) {
@@ -21,6 +25,7 @@ int main(void) {
         result = b;
     }
 
-    fwrite(&result, sizeof(uint32_t), 1, stdout);
-    return 0;
+    return bench_output_u32(out, result);
 }
+
+int main(void) { return bench_main(kernel); }
@@ -0,0 +1,60 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+
+#define STEPS 16
+
+/* 32 bytes, the input record layout. */
+typedef struct {
+    uint32_t x, y, z;
+    uint32_t vx, vy, vz;
+    uint32_t mass;
+    uint32_t id;
+} particle;
+
+/*
+ * Input: 32-byte particle records of eight u32 LE fields (x, y, z, vx, vy,
+ * vz, mass, id); a partial trailing record is ignored.
+ *
+ * STEPS passes of x += vx, y += vy, z += vz, then one pass summing mass
+ * where x < y and x + y + z over every particle, all u32 with wrap.
+ * Output: the particle count, the mass sum and the position sum as u32 LE.
+ *
+ * Array of structs: every update pass drags mass and id through the
+ * cache with the fields it uses. particles_soa.c is the same kernel with
+ * one array per field.
+ */
+static int kernel(const uint8_t *input, size_t len, bench_output *out) {
+    size_t n = len / sizeof(particle);
+    particle *p = malloc(n * sizeof *p + 1);
+    if (!p) {
+        return 1;
+    }
+    memcpy(p, input, n * sizeof *p);
+
+    for (int step = 0; step < STEPS; step++) {
+        for (size_t i = 0; i < n; i++) {
+            p[i].x += p[i].vx;
+            p[i].y += p[i].vy;
+            p[i].z += p[i].vz;
+        }
+    }
+
+    uint32_t mass = 0;
+    uint32_t pos = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (p[i].x < p[i].y) mass += p[i].mass;
+        pos += p[i].x + p[i].y + p[i].z;
+    }
+
+    free(p);
+    if (bench_output_u32(out, (uint32_t)n) != 0 || bench_output_u32(out, mass) != 0) {
+        return 1;
+    }
+    return bench_output_u32(out, pos);
+}
+
+int main(void) { return bench_main(kernel); }
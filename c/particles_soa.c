@@ -0,0 +1,64 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+
+#define STEPS 16
+#define FIELDS 8
+
+/* One array per field, in input record order. */
+typedef struct {
+    uint32_t *x, *y, *z;
+    uint32_t *vx, *vy, *vz;
+    uint32_t *mass;
+    uint32_t *id;
+} particles;
+
+/*
+ * Same input, kernel and output as particles_aos.c, with the records
+ * transposed into one array per field first. The update passes then read
+ * and write only the six arrays they use, in unit stride, which also lets
+ * the compiler vectorize them. The transpose is part of the measured time.
+ */
+static int kernel(const uint8_t *input, size_t len, bench_output *out) {
+    size_t n = len / (FIELDS * 4);
+    uint32_t *pool = malloc(FIELDS * n * sizeof *pool + 1);
+    if (!pool) {
+        return 1;
+    }
+    particles p = {pool,         pool + n,     pool + 2 * n, pool + 3 * n,
+                   pool + 4 * n, pool + 5 * n, pool + 6 * n, pool + 7 * n};
+
+    for (size_t i = 0; i < n; i++) {
+        uint32_t rec[FIELDS];
+        memcpy(rec, input + i * sizeof rec, sizeof rec);
+        for (int f = 0; f < FIELDS; f++) {
+            pool[f * n + i] = rec[f];
+        }
+    }
+
+    for (int step = 0; step < STEPS; step++) {
+        for (size_t i = 0; i < n; i++) {
+            p.x[i] += p.vx[i];
+            p.y[i] += p.vy[i];
+            p.z[i] += p.vz[i];
+        }
+    }
+
+    uint32_t mass = 0;
+    uint32_t pos = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (p.x[i] < p.y[i]) mass += p.mass[i];
+        pos += p.x[i] + p.y[i] + p.z[i];
+    }
+
+    free(pool);
+    if (bench_output_u32(out, (uint32_t)n) != 0 || bench_output_u32(out, mass) != 0) {
+        return 1;
+    }
+    return bench_output_u32(out, pos);
+}
+
+int main(void) { return bench_main(kernel); }
@@ -0,0 +1,30 @@
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "bench.h"
+#include "byte_freq_kernel.h"
+#include "regex_replace_kernel.h"
+#include "rle_encode_kernel.h"
+
+/*
+ * Fused pipeline: regex_replace, then rle_encode, then byte_freq, in one
+ * process. Each stage is the kernel its own program runs, from the shared
+ * *_kernel.h headers, and hands its output buffer straight to the next.
+ * The input is a regex_replace input and the output is byte_freq's.
+ * run_benchmarks.py times this against the three programs connected by
+ * pipes (the *-pipe rows).
+ */
+static int kernel(const uint8_t *input, size_t len, bench_output *out) {
+    bench_output replaced = {0};
+    bench_output encoded = {0};
+
+    int rc = regex_replace_kernel(input, len, &replaced);
+    if (rc == 0) rc = rle_encode_kernel(replaced.data, replaced.len, &encoded);
+    if (rc == 0) rc = byte_freq_kernel(encoded.data, encoded.len, out);
+
+    free(replaced.data);
+    free(encoded.data);
+    return rc;
+}
+
+int main(void) { return bench_main(kernel); }
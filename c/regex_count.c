@@ -2,72 +2,53 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include <regex.h>
 
-int main(void) {
-    uint8_t *input = NULL;
-    size_t capacity = 0;
-    size_t len = 0;
-
-    int c;
-    while ((c = getchar()) != EOF) {
-        if (len >= capacity) {
-            capacity = capacity ? capacity * 2 : 4096;
-            input = realloc(input, capacity);
-        }
-        input[len++] = (uint8_t)c;
-    }
+#include "bench.h"
+#include "regex_engine.h"
 
+static int kernel(const uint8_t *input, size_t len, bench_output *out) {
     if (len < 4) {
-        uint32_t result = 0;
-        fwrite(&result, sizeof(uint32_t), 1, stdout);
-        free(input);
-        return 0;
+        return bench_output_u32(out, 0);
     }
 
     uint32_t pat_len;
     memcpy(&pat_len, input, 4);
 
     if (4 + pat_len > len) {
-        uint32_t result = 0;
-        fwrite(&result, sizeof(uint32_t), 1, stdout);
-        free(input);
-        return 0;
+        return bench_output_u32(out, 0);
     }
 
-    char *pattern = malloc(pat_len + 1);
-    memcpy(pattern, input + 4, pat_len);
-    pattern[pat_len] = '\0';
+    const char *pattern = (const char *)input + 4;
 
     size_t text_len = len - 4 - pat_len;
     char *text = malloc(text_len + 1);
+    if (!text) return 1;
     memcpy(text, input + 4 + pat_len, text_len);
     text[text_len] = '\0';
 
-    regex_t regex;
-    int ret = regcomp(&regex, pattern, REG_EXTENDED);
+    bench_regex regex;
+    int ret = bench_regex_compile(&regex, pattern, pat_len, 0);
+    if (ret == BENCH_REGEX_ENGINE_ERROR) {
+        free(text);
+        return 1;
+    }
 
     uint32_t count = 0;
     if (ret == 0) {
-        regmatch_t match;
-        const char *cursor = text;
-        while (regexec(&regex, cursor, 1, &match, 0) == 0) {
+        /* Each search resumes at an absolute offset instead of rescanning from a new string start. */
+        size_t pos = 0;
+        size_t so, eo;
+        while (pos <= text_len &&
+               bench_regex_search(&regex, text, text_len, pos, &so, &eo) == 1) {
             count++;
-            if (match.rm_eo == 0) {
-                cursor++;
-                if (*cursor == '\0') break;
-            } else {
-                cursor += match.rm_eo;
-            }
-            if (*cursor == '\0') break;
+            /* Step past an empty match so it is not found again, as Rust's find_iter does. */
+            pos = (eo == so) ? so + 1 : eo;
         }
-        regfree(&regex);
+        bench_regex_free(&regex);
     }
 
-    fwrite(&count, sizeof(uint32_t), 1, stdout);
-
-    free(pattern);
     free(text);
-    free(input);
-    return 0;
+    return bench_output_u32(out, count);
 }
+
+int main(void) { return bench_main(kernel); }
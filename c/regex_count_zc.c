@@ -0,0 +1,46 @@
+/*
+ * Zero-copy regex_count: searches the input buffer in place instead of
+ * copying the text into a NUL-terminated string. Needs a length-aware
+ * engine (REG_STARTEND for POSIX, or PCRE2/RE2).
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "bench.h"
+#include "regex_engine.h"
+
+#if BENCH_REGEX == BENCH_REGEX_POSIX && !defined(REG_STARTEND)
+#error "regex_count_zc needs REG_STARTEND"
+#endif
+
+static int kernel(const uint8_t *input, size_t len, bench_output *out) {
+    uint32_t count = 0;
+    uint32_t pat_len = 0;
+    if (len >= 4) memcpy(&pat_len, input, 4);
+
+    if (len >= 4 && 4 + (size_t)pat_len <= len) {
+        const char *pattern = (const char *)input + 4;
+        const char *text = pattern + pat_len;
+        size_t text_len = len - 4 - pat_len;
+
+        bench_regex regex;
+        int ret = bench_regex_compile(&regex, pattern, pat_len, 0);
+        if (ret == BENCH_REGEX_ENGINE_ERROR) return 1;
+        if (ret == 0) {
+            size_t pos = 0;
+            size_t so, eo;
+            while (pos <= text_len &&
+                   bench_regex_search(&regex, text, text_len, pos, &so, &eo) == 1) {
+                count++;
+                /* Step past an empty match so it is not found again, as Rust's find_iter does. */
+                pos = (eo == so) ? so + 1 : eo;
+            }
+            bench_regex_free(&regex);
+        }
+    }
+
+    return bench_output_u32(out, count);
+}
+
+int main(void) { return bench_main(kernel); }
@@ -0,0 +1,181 @@
+/*
+ * Build-time selectable regex backend for the C regex benchmarks.
+ *
+ * BENCH_REGEX picks the engine:
+ *   BENCH_REGEX_POSIX  regcomp/regexec from libc (default)
+ *   BENCH_REGEX_PCRE2  PCRE2 with the JIT enabled (link -lpcre2-8)
+ *   BENCH_REGEX_RE2    RE2 through the C++ shim in regex_engine_re2.cc
+ *                      (link -lre2 and the C++ runtime)
+ *
+ * All engines search text[start, len) and report absolute match offsets.
+ * A match at start > 0 is not treated as the beginning of the text, so
+ * `^` only matches at offset 0. The POSIX backend uses REG_STARTEND where
+ * libc provides it; otherwise text[len] must be a NUL byte.
+ */
+#ifndef BENCH_REGEX_ENGINE_H
+#define BENCH_REGEX_ENGINE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BENCH_REGEX_POSIX 0
+#define BENCH_REGEX_PCRE2 1
+#define BENCH_REGEX_RE2 2
+
+#ifndef BENCH_REGEX
+#define BENCH_REGEX BENCH_REGEX_POSIX
+#endif
+
+/* Compile flag: the caller only needs a yes/no answer, not offsets. */
+#define BENCH_REGEX_MATCH_ONLY 1
+
+/*
+ * bench_regex_compile returns 0, or -1 when the engine rejects the pattern
+ * (the programs then treat it as matching nothing). BENCH_REGEX_ENGINE_ERROR
+ * means the engine cannot run the pattern the way the row is labelled; the
+ * kernels fail on it instead.
+ */
+#define BENCH_REGEX_ENGINE_ERROR (-2)
+
+#if BENCH_REGEX == BENCH_REGEX_POSIX
+
+#include <regex.h>
+
+typedef struct {
+    regex_t re;
+} bench_regex;
+
+static inline const char *bench_regex_name(void) { return "posix"; }
+
+static inline int bench_regex_compile(bench_regex *r, const char *pat, size_t pat_len, int flags) {
+    char *pattern = malloc(pat_len + 1);
+    if (!pattern) return -1;
+    memcpy(pattern, pat, pat_len);
+    pattern[pat_len] = '\0';
+
+    int cflags = REG_EXTENDED;
+    if (flags & BENCH_REGEX_MATCH_ONLY) cflags |= REG_NOSUB;
+    int ret = regcomp(&r->re, pattern, cflags);
+    free(pattern);
+    return ret == 0 ? 0 : -1;
+}
+
+/* Returns 1 on a match, 0 when there is none, -1 on engine error. */
+static inline int bench_regex_search(bench_regex *r, const char *text, size_t len, size_t start,
+                                     size_t *so, size_t *eo) {
+    regmatch_t m;
+    int eflags = start > 0 ? REG_NOTBOL : 0;
+#ifdef REG_STARTEND
+    /* Bounds come from m, so regexec does not strlen() the rest of the text per call. */
+    m.rm_so = (regoff_t)start;
+    m.rm_eo = (regoff_t)len;
+    int ret = regexec(&r->re, text, 1, &m, eflags | REG_STARTEND);
+    size_t base = 0;
+#else
+    int ret = regexec(&r->re, text + start, 1, &m, eflags);
+    size_t base = start;
+#endif
+    if (ret == REG_NOMATCH) return 0;
+    if (ret != 0) return -1;
+    *so = base + (size_t)m.rm_so;
+    *eo = base + (size_t)m.rm_eo;
+    return 1;
+}
+
+static inline void bench_regex_free(bench_regex *r) { regfree(&r->re); }
+
+#elif BENCH_REGEX == BENCH_REGEX_PCRE2
+
+#define PCRE2_CODE_UNIT_WIDTH 8
+#include <pcre2.h>
+#include <stdio.h>
+
+typedef struct {
+    pcre2_code *code;
+    pcre2_match_data *md;
+    int utf_checked;
+} bench_regex;
+
+static inline const char *bench_regex_name(void) { return "pcre2-jit"; }
+
+static inline int bench_regex_compile(bench_regex *r, const char *pat, size_t pat_len, int flags) {
+    (void)flags;
+    int err;
+    PCRE2_SIZE err_off;
+    /* UTF + UCP gives the same Unicode-aware classes as Rust's regex crate. */
+    r->code = pcre2_compile((PCRE2_SPTR)pat, pat_len, PCRE2_UTF | PCRE2_UCP, &err, &err_off, NULL);
+    if (!r->code) return -1;
+    /*
+     * The row is labelled pcre2-jit, so a pattern the JIT rejects (or a
+     * libpcre2 built without it) fails the run rather than quietly
+     * matching in the interpreter.
+     */
+    int jit = pcre2_jit_compile(r->code, PCRE2_JIT_COMPLETE);
+    if (jit != 0) {
+        PCRE2_UCHAR msg[256];
+        pcre2_get_error_message(jit, msg, sizeof msg);
+        fprintf(stderr, "pcre2 JIT compile failed: %s\n", (const char *)msg);
+        pcre2_code_free(r->code);
+        return BENCH_REGEX_ENGINE_ERROR;
+    }
+    r->md = pcre2_match_data_create_from_pattern(r->code, NULL);
+    r->utf_checked = 0;
+    if (!r->md) {
+        pcre2_code_free(r->code);
+        return -1;
+    }
+    return 0;
+}
+
+static inline int bench_regex_search(bench_regex *r, const char *text, size_t len, size_t start,
+                                     size_t *so, size_t *eo) {
+    /* Validate UTF-8 once per subject rather than on every resumed search. */
+    uint32_t opts = r->utf_checked ? PCRE2_NO_UTF_CHECK : 0;
+    int rc = pcre2_match(r->code, (PCRE2_SPTR)text, len, start, opts, r->md, NULL);
+    r->utf_checked = 1;
+    if (rc == PCRE2_ERROR_NOMATCH) return 0;
+    if (rc < 0) return -1;
+    PCRE2_SIZE *ov = pcre2_get_ovector_pointer(r->md);
+    *so = ov[0];
+    *eo = ov[1];
+    return 1;
+}
+
+static inline void bench_regex_free(bench_regex *r) {
+    pcre2_match_data_free(r->md);
+    pcre2_code_free(r->code);
+}
+
+#elif BENCH_REGEX == BENCH_REGEX_RE2
+
+/* Implemented in regex_engine_re2.cc. */
+void *bench_re2_compile(const char *pat, size_t pat_len);
+int bench_re2_search(void *re, const char *text, size_t len, size_t start, size_t *so, size_t *eo);
+void bench_re2_free(void *re);
+
+typedef struct {
+    void *re;
+} bench_regex;
+
+static inline const char *bench_regex_name(void) { return "re2"; }
+
+static inline int bench_regex_compile(bench_regex *r, const char *pat, size_t pat_len, int flags) {
+    (void)flags;
+    r->re = bench_re2_compile(pat, pat_len);
+    return r->re ? 0 : -1;
+}
+
+static inline int bench_regex_search(bench_regex *r, const char *text, size_t len, size_t start,
+                                     size_t *so, size_t *eo) {
+    return bench_re2_search(r->re, text, len, start, so, eo);
+}
+
+static inline void bench_regex_free(bench_regex *r) { bench_re2_free(r->re); }
+
+#else
+#error "unknown BENCH_REGEX backend"
+#endif
+
+#endif
@@ -0,0 +1,35 @@
+// C ABI shim over RE2 for regex_engine.h (BENCH_REGEX=BENCH_REGEX_RE2).
+
+#include <re2/re2.h>
+
+#include <cstddef>
+#include <new>
+
+extern "C" {
+
+void *bench_re2_compile(const char *pat, size_t pat_len) {
+    RE2::Options opts;
+    opts.set_log_errors(false);
+    RE2 *re = new (std::nothrow) RE2(re2::StringPiece(pat, pat_len), opts);
+    if (re == nullptr) return nullptr;
+    if (!re->ok()) {
+        delete re;
+        return nullptr;
+    }
+    return re;
+}
+
+int bench_re2_search(void *handle, const char *text, size_t len, size_t start, size_t *so,
+                     size_t *eo) {
+    const RE2 *re = static_cast<const RE2 *>(handle);
+    re2::StringPiece subject(text, len);
+    re2::StringPiece m;
+    if (!re->Match(subject, start, len, RE2::UNANCHORED, &m, 1)) return 0;
+    *so = static_cast<size_t>(m.data() - text);
+    *eo = *so + m.size();
+    return 1;
+}
+
+void bench_re2_free(void *handle) { delete static_cast<RE2 *>(handle); }
+
+}
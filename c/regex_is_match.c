@@ -2,62 +2,46 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include <regex.h>
-
-int main(void) {
-    uint8_t *input = NULL;
-    size_t capacity = 0;
-    size_t len = 0;
-
-    int c;
-    while ((c = getchar()) != EOF) {
-        if (len >= capacity) {
-            capacity = capacity ? capacity * 2 : 4096;
-            input = realloc(input, capacity);
-        }
-        input[len++] = (uint8_t)c;
-    }
 
+#include "bench.h"
+#include "regex_engine.h"
+
+static int kernel(const uint8_t *input, size_t len, bench_output *out) {
     if (len < 4) {
-        uint32_t result = 0;
-        fwrite(&result, sizeof(uint32_t), 1, stdout);
-        free(input);
-        return 0;
+        return bench_output_u32(out, 0);
     }
 
     uint32_t pat_len;
     memcpy(&pat_len, input, 4);
 
     if (4 + pat_len > len) {
-        uint32_t result = 0;
-        fwrite(&result, sizeof(uint32_t), 1, stdout);
-        free(input);
-        return 0;
+        return bench_output_u32(out, 0);
     }
 
-    char *pattern = malloc(pat_len + 1);
-    memcpy(pattern, input + 4, pat_len);
-    pattern[pat_len] = '\0';
+    const char *pattern = (const char *)input + 4;
 
     size_t text_len = len - 4 - pat_len;
     char *text = malloc(text_len + 1);
+    if (!text) return 1;
     memcpy(text, input + 4 + pat_len, text_len);
     text[text_len] = '\0';
 
-    regex_t regex;
-    int ret = regcomp(&regex, pattern, REG_EXTENDED | REG_NOSUB);
+    bench_regex regex;
+    int ret = bench_regex_compile(&regex, pattern, pat_len, BENCH_REGEX_MATCH_ONLY);
+    if (ret == BENCH_REGEX_ENGINE_ERROR) {
+        free(text);
+        return 1;
+    }
 
     uint32_t result = 0;
     if (ret == 0) {
-        ret = regexec(&regex, text, 0, NULL, 0);
-        result = (ret == 0) ? 1 : 0;
-        regfree(&regex);
+        size_t so, eo;
+        result = bench_regex_search(&regex, text, text_len, 0, &so, &eo) == 1 ? 1 : 0;
+        bench_regex_free(&regex);
     }
 
-    fwrite(&result, sizeof(uint32_t), 1, stdout);
-
-    free(pattern);
     free(text);
-    free(input);
-    return 0;
+    return bench_output_u32(out, result);
 }
+
+int main(void) { return bench_main(kernel); }
@@ -0,0 +1,40 @@
+/*
+ * Zero-copy regex_is_match: searches the input buffer in place instead of
+ * copying the text into a NUL-terminated string. Needs a length-aware
+ * engine (REG_STARTEND for POSIX, or PCRE2/RE2).
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "bench.h"
+#include "regex_engine.h"
+
+#if BENCH_REGEX == BENCH_REGEX_POSIX && !defined(REG_STARTEND)
+#error "regex_is_match_zc needs REG_STARTEND"
+#endif
+
+static int kernel(const uint8_t *input, size_t len, bench_output *out) {
+    uint32_t result = 0;
+    uint32_t pat_len = 0;
+    if (len >= 4) memcpy(&pat_len, input, 4);
+
+    if (len >= 4 && 4 + (size_t)pat_len <= len) {
+        const char *pattern = (const char *)input + 4;
+        const char *text = pattern + pat_len;
+        size_t text_len = len - 4 - pat_len;
+
+        bench_regex regex;
+        int ret = bench_regex_compile(&regex, pattern, pat_len, BENCH_REGEX_MATCH_ONLY);
+        if (ret == BENCH_REGEX_ENGINE_ERROR) return 1;
+        if (ret == 0) {
+            size_t so, eo;
+            result = bench_regex_search(&regex, text, text_len, 0, &so, &eo) == 1 ? 1 : 0;
+            bench_regex_free(&regex);
+        }
+    }
+
+    return bench_output_u32(out, result);
+}
+
+int main(void) { return bench_main(kernel); }
@@ -0,0 +1,100 @@
+/*
+ * The regex_replace kernel, shared by regex_replace.c and pipeline.c.
+ *
+ * Input: u32 LE pattern length, u32 LE replacement length, the pattern,
+ * the replacement, then the text. Output: the text with every match
+ * replaced.
+ */
+#ifndef REGEX_REPLACE_KERNEL_H
+#define REGEX_REPLACE_KERNEL_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+#include "regex_engine.h"
+
+static int regex_replace_kernel(const uint8_t *input, size_t len, bench_output *out) {
+    if (len < 8) {
+        return bench_output_write(out, input, len);
+    }
+
+    uint32_t pat_len, repl_len;
+    memcpy(&pat_len, input, 4);
+    memcpy(&repl_len, input + 4, 4);
+
+    if (8 + pat_len + repl_len > len) {
+        size_t text_start = 8 + pat_len + repl_len;
+        if (text_start <= len) {
+            return bench_output_write(out, input + text_start, len - text_start);
+        }
+        return 0;
+    }
+
+    const char *pattern = (const char *)input + 8;
+    const char *replacement = (const char *)input + 8 + pat_len;
+
+    size_t text_len = len - 8 - pat_len - repl_len;
+    char *text = malloc(text_len + 1);
+    if (!text) return 1;
+    memcpy(text, input + 8 + pat_len + repl_len, text_len);
+    text[text_len] = '\0';
+
+    bench_regex regex;
+    int ret = bench_regex_compile(&regex, pattern, pat_len, 0);
+    if (ret == BENCH_REGEX_ENGINE_ERROR) {
+        free(text);
+        return 1;
+    }
+
+    if (ret != 0) {
+        ret = bench_output_write(out, text, text_len);
+        free(text);
+        return ret;
+    }
+
+    if (bench_output_reserve(out, text_len * 2 + 1024) != 0) {
+        bench_regex_free(&regex);
+        free(text);
+        return 1;
+    }
+
+    size_t pos = 0;
+    size_t so, eo;
+
+    while (pos < text_len && bench_regex_search(&regex, text, text_len, pos, &so, &eo) == 1) {
+        size_t prefix_len = so - pos;
+
+        if (bench_output_reserve(out, prefix_len + repl_len + (text_len - pos)) != 0) {
+            ret = 1;
+            break;
+        }
+
+        memcpy(out->data + out->len, text + pos, prefix_len);
+        out->len += prefix_len;
+
+        memcpy(out->data + out->len, replacement, repl_len);
+        out->len += repl_len;
+
+        if (eo == so) {
+            /* Empty match: keep the next byte and step past it. */
+            if (so < text_len) {
+                out->data[out->len++] = (uint8_t)text[so];
+            }
+            pos = so + 1;
+        } else {
+            pos = eo;
+        }
+    }
+
+    if (ret == 0 && pos < text_len) {
+        ret = bench_output_write(out, text + pos, text_len - pos);
+    }
+
+    bench_regex_free(&regex);
+    free(text);
+    return ret;
+}
+
+#endif
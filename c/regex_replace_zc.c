@@ -0,0 +1,121 @@
+/*
+ * Zero-copy regex_replace: matches in place over the input buffer and
+ * writes the result with writev(2) as a list of spans, alternating unchanged
+ * text and the replacement, so neither the text nor the output is copied.
+ * That keeps it outside bench_main (see bench.h).
+ * Needs a length-aware engine (REG_STARTEND for POSIX, or PCRE2/RE2).
+ */
+#include <errno.h>
+#include <limits.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include "bench.h"
+#include "regex_engine.h"
+
+#if BENCH_REGEX == BENCH_REGEX_POSIX && !defined(REG_STARTEND)
+#error "regex_replace_zc needs REG_STARTEND"
+#endif
+
+#ifndef IOV_MAX
+#define IOV_MAX 1024
+#endif
+
+/* Spans queued per writev call; bounded by IOV_MAX. */
+#define ZC_IOV_BATCH (IOV_MAX < 1024 ? IOV_MAX : 1024)
+
+typedef struct {
+    struct iovec iov[ZC_IOV_BATCH];
+    int n;
+    int failed;
+} span_writer;
+
+/* Writes every queued span, resuming after short writes. */
+static void spans_flush(span_writer *w) {
+    struct iovec *iov = w->iov;
+    int n = w->n;
+    while (n > 0 && !w->failed) {
+        ssize_t written = writev(STDOUT_FILENO, iov, n);
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            w->failed = 1;
+            break;
+        }
+        while (n > 0 && (size_t)written >= iov->iov_len) {
+            written -= (ssize_t)iov->iov_len;
+            iov++;
+            n--;
+        }
+        if (n > 0) {
+            iov->iov_base = (char *)iov->iov_base + written;
+            iov->iov_len -= (size_t)written;
+        }
+    }
+    w->n = 0;
+}
+
+static void spans_add(span_writer *w, const void *p, size_t len) {
+    if (len == 0) return;
+    if (w->n == ZC_IOV_BATCH) spans_flush(w);
+    w->iov[w->n].iov_base = (void *)p;
+    w->iov[w->n].iov_len = len;
+    w->n++;
+}
+
+int main(void) {
+    bench_input in;
+    if (bench_read_input(&in) != 0) {
+        return 1;
+    }
+
+    span_writer w = {.n = 0, .failed = 0};
+    const uint8_t *input = in.data;
+    size_t len = in.len;
+
+    uint32_t pat_len = 0, repl_len = 0;
+    if (len >= 8) {
+        memcpy(&pat_len, input, 4);
+        memcpy(&repl_len, input + 4, 4);
+    }
+
+    if (len < 8) {
+        spans_add(&w, input, len);
+    } else if (8 + (size_t)pat_len + repl_len <= len) {
+        const char *pattern = (const char *)input + 8;
+        const char *replacement = pattern + pat_len;
+        const char *text = replacement + repl_len;
+        size_t text_len = len - 8 - pat_len - repl_len;
+
+        bench_regex regex;
+        int ret = bench_regex_compile(&regex, pattern, pat_len, 0);
+        if (ret == BENCH_REGEX_ENGINE_ERROR) {
+            w.failed = 1;
+        } else if (ret != 0) {
+            spans_add(&w, text, text_len);
+        } else {
+            size_t pos = 0;
+            size_t so, eo;
+            while (pos < text_len &&
+                   bench_regex_search(&regex, text, text_len, pos, &so, &eo) == 1) {
+                spans_add(&w, text + pos, so - pos);
+                spans_add(&w, replacement, repl_len);
+                if (eo == so) {
+                    /* Empty match: keep the next byte and step past it. */
+                    if (so < text_len) spans_add(&w, text + so, 1);
+                    pos = so + 1;
+                } else {
+                    pos = eo;
+                }
+            }
+            if (pos < text_len) spans_add(&w, text + pos, text_len - pos);
+            bench_regex_free(&regex);
+        }
+    }
+
+    spans_flush(&w);
+    bench_free_input(&in);
+    return w.failed;
+}
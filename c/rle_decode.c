@@ -0,0 +1,36 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+
+/*
+ * Input: (cnt, byte) pairs as written by rle_encode; a trailing odd byte
+ * is ignored. Output: each byte repeated cnt times.
+ */
+static int kernel(const uint8_t *input, size_t len, bench_output *out) {
+    size_t pairs = len / 2;
+    size_t total = 0;
+
+    for (size_t i = 0; i < pairs; i++) {
+        total += input[2 * i];
+    }
+
+    if (bench_output_reserve(out, total) != 0) {
+        return 1;
+    }
+    uint8_t *output = out->data;
+    size_t out_len = 0;
+
+    for (size_t i = 0; i < pairs; i++) {
+        uint8_t cnt = input[2 * i];
+        memset(output + out_len, input[2 * i + 1], cnt);
+        out_len += cnt;
+    }
+
+    out->len = out_len;
+    return 0;
+}
+
+int main(void) { return bench_main(kernel); }
@@ -0,0 +1,51 @@
+/*
+ * The rle_encode kernel, shared by rle_encode.c and pipeline.c: (count,
+ * byte) pairs, with runs split at 255.
+ */
+#ifndef RLE_ENCODE_KERNEL_H
+#define RLE_ENCODE_KERNEL_H
+
+#include <stdint.h>
+
+#include "bench.h"
+
+static int rle_encode_kernel(const uint8_t *input, size_t len, bench_output *out) {
+    if (len == 0) {
+        return 0;
+    }
+
+    if (bench_output_reserve(out, len * 2) != 0) {
+        return 1;
+    }
+    uint8_t *output = out->data;
+    size_t out_len = 0;
+
+    uint8_t cur = input[0];
+    uint8_t cnt = 1;
+
+    for (size_t i = 1; i < len; i++) {
+        uint8_t x = input[i];
+        if (x == cur) {
+            if (cnt < 255) {
+                cnt++;
+            } else {
+                output[out_len++] = cnt;
+                output[out_len++] = cur;
+                cnt = 1;
+            }
+        } else {
+            output[out_len++] = cnt;
+            output[out_len++] = cur;
+            cur = x;
+            cnt = 1;
+        }
+    }
+
+    output[out_len++] = cnt;
+    output[out_len++] = cur;
+
+    out->len = out_len;
+    return 0;
+}
+
+#endif
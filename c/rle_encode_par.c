@@ -0,0 +1,98 @@
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bench.h"
+
+typedef struct {
+    const uint8_t *p;
+    size_t len;
+    uint8_t *out;
+    size_t out_len;
+} rle_task;
+
+static void *rle_worker(void *arg) {
+    rle_task *t = arg;
+    if (t->len == 0) {
+        return NULL;
+    }
+
+    uint8_t *output = t->out;
+    size_t out_len = 0;
+    uint8_t cur = t->p[0];
+    uint8_t cnt = 1;
+
+    for (size_t i = 1; i < t->len; i++) {
+        uint8_t x = t->p[i];
+        if (x == cur) {
+            if (cnt < 255) {
+                cnt++;
+            } else {
+                output[out_len++] = cnt;
+                output[out_len++] = cur;
+                cnt = 1;
+            }
+        } else {
+            output[out_len++] = cnt;
+            output[out_len++] = cur;
+            cur = x;
+            cnt = 1;
+        }
+    }
+
+    output[out_len++] = cnt;
+    output[out_len++] = cur;
+    t->out_len = out_len;
+    return NULL;
+}
+
+int main(int argc, char **argv) {
+    int threads = bench_thread_count(argc, argv);
+
+    bench_input in;
+    if (bench_read_input(&in) != 0) {
+        return 1;
+    }
+    const uint8_t *input = in.data;
+    size_t len = in.len;
+
+    uint8_t *output = malloc(len * 2 + 1);
+    if (!output) {
+        return 1;
+    }
+
+    /*
+     * Chunk edges are pushed forward to the next run boundary, so every chunk
+     * encodes independently and the concatenation matches the serial output.
+     */
+    size_t bound[257];
+    bound[0] = 0;
+    for (int k = 1; k < threads; k++) {
+        size_t b = bench_chunk_start(len, threads, k);
+        if (b < bound[k - 1]) b = bound[k - 1];
+        while (b > 0 && b < len && input[b] == input[b - 1]) b++;
+        bound[k] = b;
+    }
+    bound[threads] = len;
+
+    pthread_t tid[256];
+    rle_task task[256];
+    for (int k = 0; k < threads; k++) {
+        size_t start = bound[k];
+        size_t end = bound[k + 1];
+        task[k] = (rle_task){input + start, end - start, output + start * 2, 0};
+        if (pthread_create(&tid[k], NULL, rle_worker, &task[k]) != 0) {
+            return 1;
+        }
+    }
+
+    for (int k = 0; k < threads; k++) {
+        pthread_join(tid[k], NULL);
+        fwrite(task[k].out, 1, task[k].out_len, stdout);
+    }
+
+    free(output);
+    bench_free_input(&in);
+    return 0;
+}
@@ -0,0 +1,97 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "bench.h"
+
+/*
+ * Index of the first byte in p[i, len) that differs from c, or len.
+ *
+ * Compares a vector (or a word) against c broadcast to every lane and
+ * takes the first mismatch from count-trailing-zeros, so a long run costs
+ * one branch per block instead of one per byte. NEON has no movemask, so
+ * ARM builds use the word loop.
+ */
+static size_t run_end(const uint8_t *p, size_t i, size_t len, uint8_t c) {
+#if defined(__AVX2__)
+    const __m256i bc = _mm256_set1_epi8((char)c);
+    for (; i + 32 <= len; i += 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(p + i));
+        uint32_t ne = ~(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, bc));
+        if (ne) return i + (size_t)__builtin_ctz(ne);
+    }
+#elif defined(__SSE2__)
+    const __m128i bc = _mm_set1_epi8((char)c);
+    for (; i + 16 <= len; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(p + i));
+        uint32_t ne = ~(uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(v, bc)) & 0xFFFFu;
+        if (ne) return i + (size_t)__builtin_ctz(ne);
+    }
+#endif
+
+    /* XOR against the broadcast byte leaves a zero byte wherever the word matches. */
+    const uint64_t bw = 0x0101010101010101ull * c;
+    for (; i + 8 <= len; i += 8) {
+        uint64_t w;
+        memcpy(&w, p + i, sizeof w);
+        uint64_t x = w ^ bw;
+        if (x) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+            return i + (size_t)(__builtin_clzll(x) >> 3);
+#else
+            return i + (size_t)(__builtin_ctzll(x) >> 3);
+#endif
+        }
+    }
+
+    while (i < len && p[i] == c) i++;
+    return i;
+}
+
+/* Same (cnt, byte) pairs as rle_encode.c, with runs longer than 255 split. */
+static size_t rle_encode(const uint8_t *p, size_t len, uint8_t *out) {
+    size_t out_len = 0;
+    size_t i = 0;
+
+    while (i < len) {
+        uint8_t c = p[i];
+        size_t end = run_end(p, i + 1, len, c);
+        size_t n = end - i;
+        while (n > 255) {
+            out[out_len++] = 255;
+            out[out_len++] = c;
+            n -= 255;
+        }
+        out[out_len++] = (uint8_t)n;
+        out[out_len++] = c;
+        i = end;
+    }
+
+    return out_len;
+}
+
+int main(void) {
+    bench_input in;
+    if (bench_read_input(&in) != 0) {
+        return 1;
+    }
+
+    uint8_t *output = malloc(in.len * 2 + 1);
+    if (!output) {
+        return 1;
+    }
+    size_t out_len = rle_encode(in.data, in.len, output);
+
+    fwrite(output, 1, out_len, stdout);
+
+    free(output);
+    bench_free_input(&in);
+    return 0;
+}
@@ -0,0 +1,58 @@
+#include <stdint.h>
+#include <stdio.h>
+
+#include "bench.h"
+
+int main(void) {
+    static uint8_t buf[BENCH_STREAM_CHUNK];
+    /* Worst case every input byte closes a run: two output bytes each. */
+    static uint8_t output[BENCH_STREAM_CHUNK * 2];
+
+    /* The open run is carried across chunk edges and only emitted once it ends. */
+    int have_run = 0;
+    uint8_t cur = 0;
+    uint8_t cnt = 0;
+
+    ssize_t n;
+    while ((n = bench_read_chunk(buf, sizeof buf)) > 0) {
+        size_t out_len = 0;
+        ssize_t i = 0;
+
+        if (!have_run) {
+            cur = buf[0];
+            cnt = 1;
+            have_run = 1;
+            i = 1;
+        }
+
+        for (; i < n; i++) {
+            uint8_t x = buf[i];
+            if (x == cur) {
+                if (cnt < 255) {
+                    cnt++;
+                } else {
+                    output[out_len++] = cnt;
+                    output[out_len++] = cur;
+                    cnt = 1;
+                }
+            } else {
+                output[out_len++] = cnt;
+                output[out_len++] = cur;
+                cur = x;
+                cnt = 1;
+            }
+        }
+
+        fwrite(output, 1, out_len, stdout);
+    }
+    if (n < 0) {
+        return 1;
+    }
+
+    if (have_run) {
+        output[0] = cnt;
+        output[1] = cur;
+        fwrite(output, 1, 2, stdout);
+    }
+    return 0;
+}
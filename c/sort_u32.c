@@ -0,0 +1,60 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+
+/*
+ * Input: u32 LE values; trailing bytes past the last whole value are
+ * ignored. Output: the value count and sum((i + 1) * sorted[i]), both u32
+ * with wrap, so the result depends on the order and not just the values.
+ *
+ * LSD radix sort, one counting pass and one scatter pass per byte, the
+ * same algorithm as the X07 program. The Rust and Go programs use their
+ * standard library sorts.
+ */
+static int kernel(const uint8_t *input, size_t len, bench_output *out) {
+    size_t n = len / 4;
+    uint32_t *src = malloc(n * sizeof *src + 1);
+    uint32_t *dst = malloc(n * sizeof *dst + 1);
+    if (!src || !dst) {
+        free(src);
+        free(dst);
+        return 1;
+    }
+    memcpy(src, input, n * sizeof *src);
+
+    for (int shift = 0; shift < 32; shift += 8) {
+        size_t count[256] = {0};
+        for (size_t i = 0; i < n; i++) {
+            count[(src[i] >> shift) & 0xFF]++;
+        }
+        size_t pos = 0;
+        for (int d = 0; d < 256; d++) {
+            size_t c = count[d];
+            count[d] = pos;
+            pos += c;
+        }
+        for (size_t i = 0; i < n; i++) {
+            dst[count[(src[i] >> shift) & 0xFF]++] = src[i];
+        }
+        uint32_t *tmp = src;
+        src = dst;
+        dst = tmp;
+    }
+
+    uint32_t sum = 0;
+    for (size_t i = 0; i < n; i++) {
+        sum += (uint32_t)(i + 1) * src[i];
+    }
+
+    free(src);
+    free(dst);
+    if (bench_output_u32(out, (uint32_t)n) != 0) {
+        return 1;
+    }
+    return bench_output_u32(out, sum);
+}
+
+int main(void) { return bench_main(kernel); }
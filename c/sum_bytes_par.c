@@ -0,0 +1,53 @@
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bench.h"
+
+typedef struct {
+    const uint8_t *p;
+    size_t len;
+    uint32_t acc;
+} sum_task;
+
+static void *sum_worker(void *arg) {
+    sum_task *t = arg;
+    uint32_t acc = 0;
+    for (size_t i = 0; i < t->len; i++) {
+        acc += t->p[i];
+    }
+    t->acc = acc;
+    return NULL;
+}
+
+int main(int argc, char **argv) {
+    int threads = bench_thread_count(argc, argv);
+
+    bench_input in;
+    if (bench_read_input(&in) != 0) {
+        return 1;
+    }
+
+    pthread_t tid[256];
+    sum_task task[256];
+    for (int k = 0; k < threads; k++) {
+        size_t start = bench_chunk_start(in.len, threads, k);
+        size_t end = bench_chunk_start(in.len, threads, k + 1);
+        task[k] = (sum_task){in.data + start, end - start, 0};
+        if (pthread_create(&tid[k], NULL, sum_worker, &task[k]) != 0) {
+            return 1;
+        }
+    }
+
+    uint32_t acc = 0;
+    for (int k = 0; k < threads; k++) {
+        pthread_join(tid[k], NULL);
+        acc += task[k].acc;
+    }
+
+    fwrite(&acc, sizeof(uint32_t), 1, stdout);
+
+    bench_free_input(&in);
+    return 0;
+}
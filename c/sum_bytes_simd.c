@@ -0,0 +1,79 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+#include "bench.h"
+
+/* Horizontal byte sums: psadbw against zero on x86, pairwise widening adds on NEON. */
+static uint32_t sum_bytes(const uint8_t *p, size_t len) {
+    size_t i = 0;
+    uint64_t acc = 0;
+
+#if defined(__AVX2__)
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i s0 = zero;
+    __m256i s1 = zero;
+    for (; i + 64 <= len; i += 64) {
+        __m256i a = _mm256_loadu_si256((const __m256i *)(p + i));
+        __m256i b = _mm256_loadu_si256((const __m256i *)(p + i + 32));
+        s0 = _mm256_add_epi64(s0, _mm256_sad_epu8(a, zero));
+        s1 = _mm256_add_epi64(s1, _mm256_sad_epu8(b, zero));
+    }
+    uint64_t lanes[4];
+    _mm256_storeu_si256((__m256i *)lanes, _mm256_add_epi64(s0, s1));
+    acc = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+#elif defined(__SSE2__)
+    const __m128i zero = _mm_setzero_si128();
+    __m128i s0 = zero;
+    __m128i s1 = zero;
+    for (; i + 32 <= len; i += 32) {
+        __m128i a = _mm_loadu_si128((const __m128i *)(p + i));
+        __m128i b = _mm_loadu_si128((const __m128i *)(p + i + 16));
+        s0 = _mm_add_epi64(s0, _mm_sad_epu8(a, zero));
+        s1 = _mm_add_epi64(s1, _mm_sad_epu8(b, zero));
+    }
+    uint64_t lanes[2];
+    _mm_storeu_si128((__m128i *)lanes, _mm_add_epi64(s0, s1));
+    acc = lanes[0] + lanes[1];
+#elif defined(__ARM_NEON)
+    uint32x4_t s32 = vdupq_n_u32(0);
+    while (i + 16 <= len) {
+        /* Each u16 lane gains at most 510 per step, so 128 steps cannot overflow. */
+        uint16x8_t s16 = vdupq_n_u16(0);
+        for (int k = 0; k < 128 && i + 16 <= len; k++, i += 16) {
+            s16 = vpadalq_u8(s16, vld1q_u8(p + i));
+        }
+        s32 = vpadalq_u16(s32, s16);
+    }
+    uint32_t lanes[4];
+    vst1q_u32(lanes, s32);
+    acc = (uint64_t)lanes[0] + lanes[1] + lanes[2] + lanes[3];
+#endif
+
+    for (; i < len; i++) {
+        acc += p[i];
+    }
+    return (uint32_t)acc;
+}
+
+int main(void) {
+    bench_input in;
+    if (bench_read_input(&in) != 0) {
+        return 1;
+    }
+
+    uint32_t acc = sum_bytes(in.data, in.len);
+
+    fwrite(&acc, sizeof(uint32_t), 1, stdout);
+
+    bench_free_input(&in);
+    return 0;
+}
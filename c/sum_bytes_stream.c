@@ -0,0 +1,22 @@
+#include <stdint.h>
+#include <stdio.h>
+
+#include "bench.h"
+
+int main(void) {
+    static uint8_t buf[BENCH_STREAM_CHUNK];
+    uint32_t acc = 0;
+
+    ssize_t n;
+    while ((n = bench_read_chunk(buf, sizeof buf)) > 0) {
+        for (ssize_t i = 0; i < n; i++) {
+            acc += buf[i];
+        }
+    }
+    if (n < 0) {
+        return 1;
+    }
+
+    fwrite(&acc, sizeof(uint32_t), 1, stdout);
+    return 0;
+}
@@ -2,20 +2,9 @@
 #include <stdio.h>
 #include <stdlib.h>
 
-int main(void) {
-    uint8_t *input = NULL;
-    size_t capacity = 0;
-    size_t len = 0;
-
-    int c;
-    while ((c = getchar()) != EOF) {
-        if (len >= capacity) {
-            capacity = capacity ? capacity * 2 : 4096;
-            input = realloc(input, capacity);
-        }
-        input[len++] = (uint8_t)c;
-    }
+#include "bench.h"
 
+static int kernel(const uint8_t *input, size_t len, bench_output *out) {
     uint32_t cnt = 0;
     int in_word = 0;
 
@@ -30,8 +19,7 @@ int main(void) {
         }
     }
 
-    fwrite(&cnt, sizeof(uint32_t), 1, stdout);
-
-    free(input);
-    return 0;
+    return bench_output_u32(out, cnt);
 }
+
+int main(void) { return bench_main(kernel); }
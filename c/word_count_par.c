@@ -0,0 +1,69 @@
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bench.h"
+
+typedef struct {
+    const uint8_t *base;
+    size_t start;
+    size_t end;
+    uint32_t cnt;
+} word_task;
+
+static int is_space(uint8_t ch) {
+    return ch == 32 || ch == 10 || ch == 13 || ch == 9;
+}
+
+/* Counts word starts in [start, end); the byte before start decides the first one. */
+static void *word_worker(void *arg) {
+    word_task *t = arg;
+    uint32_t cnt = 0;
+    int in_word = t->start > 0 && !is_space(t->base[t->start - 1]);
+
+    for (size_t i = t->start; i < t->end; i++) {
+        if (is_space(t->base[i])) {
+            in_word = 0;
+        } else if (!in_word) {
+            cnt++;
+            in_word = 1;
+        }
+    }
+    t->cnt = cnt;
+    return NULL;
+}
+
+int main(int argc, char **argv) {
+    int threads = bench_thread_count(argc, argv);
+
+    bench_input in;
+    if (bench_read_input(&in) != 0) {
+        return 1;
+    }
+
+    pthread_t tid[256];
+    word_task task[256];
+    for (int k = 0; k < threads; k++) {
+        task[k] = (word_task){
+            in.data,
+            bench_chunk_start(in.len, threads, k),
+            bench_chunk_start(in.len, threads, k + 1),
+            0,
+        };
+        if (pthread_create(&tid[k], NULL, word_worker, &task[k]) != 0) {
+            return 1;
+        }
+    }
+
+    uint32_t cnt = 0;
+    for (int k = 0; k < threads; k++) {
+        pthread_join(tid[k], NULL);
+        cnt += task[k].cnt;
+    }
+
+    fwrite(&cnt, sizeof(uint32_t), 1, stdout);
+
+    bench_free_input(&in);
+    return 0;
+}
@@ -0,0 +1,99 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+#include "bench.h"
+
+/*
+ * Classifies a whole vector as whitespace at once and counts word starts as
+ * popcount(~space & (space << 1 | carry)), where carry is whether the byte
+ * before the vector was whitespace (true before the first byte).
+ */
+static uint32_t word_count(const uint8_t *p, size_t len) {
+    size_t i = 0;
+    uint32_t cnt = 0;
+    uint32_t prev_space = 1;
+
+#if defined(__AVX2__)
+    const __m256i sp = _mm256_set1_epi8(32);
+    const __m256i nl = _mm256_set1_epi8(10);
+    const __m256i cr = _mm256_set1_epi8(13);
+    const __m256i tab = _mm256_set1_epi8(9);
+    for (; i + 32 <= len; i += 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(p + i));
+        __m256i s = _mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi8(v, sp), _mm256_cmpeq_epi8(v, nl)),
+            _mm256_or_si256(_mm256_cmpeq_epi8(v, cr), _mm256_cmpeq_epi8(v, tab)));
+        uint32_t space = (uint32_t)_mm256_movemask_epi8(s);
+        uint32_t prev = (space << 1) | prev_space;
+        cnt += (uint32_t)__builtin_popcount(~space & prev);
+        prev_space = space >> 31;
+    }
+#elif defined(__SSE2__)
+    const __m128i sp = _mm_set1_epi8(32);
+    const __m128i nl = _mm_set1_epi8(10);
+    const __m128i cr = _mm_set1_epi8(13);
+    const __m128i tab = _mm_set1_epi8(9);
+    for (; i + 16 <= len; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(p + i));
+        __m128i s = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(v, sp), _mm_cmpeq_epi8(v, nl)),
+            _mm_or_si128(_mm_cmpeq_epi8(v, cr), _mm_cmpeq_epi8(v, tab)));
+        uint32_t space = (uint32_t)_mm_movemask_epi8(s);
+        uint32_t prev = ((space << 1) | prev_space) & 0xFFFF;
+        cnt += (uint32_t)__builtin_popcount(~space & prev);
+        prev_space = space >> 15;
+    }
+#elif defined(__ARM_NEON)
+    const uint8x16_t sp = vdupq_n_u8(32);
+    const uint8x16_t nl = vdupq_n_u8(10);
+    const uint8x16_t cr = vdupq_n_u8(13);
+    const uint8x16_t tab = vdupq_n_u8(9);
+    for (; i + 16 <= len; i += 16) {
+        uint8x16_t v = vld1q_u8(p + i);
+        uint8x16_t s = vorrq_u8(vorrq_u8(vceqq_u8(v, sp), vceqq_u8(v, nl)),
+                                vorrq_u8(vceqq_u8(v, cr), vceqq_u8(v, tab)));
+        /* No movemask on NEON: narrow to one nibble per byte instead. */
+        uint64_t space = vget_lane_u64(
+            vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(s), 4)), 0);
+        uint64_t prev = (space << 4) | (prev_space ? 0xFull : 0);
+        cnt += (uint32_t)__builtin_popcountll(~space & prev) / 4;
+        prev_space = (uint32_t)(space >> 63);
+    }
+#endif
+
+    int in_word = !prev_space;
+    for (; i < len; i++) {
+        uint8_t ch = p[i];
+        int is_space = (ch == 32 || ch == 10 || ch == 13 || ch == 9);
+        if (is_space) {
+            in_word = 0;
+        } else if (!in_word) {
+            cnt++;
+            in_word = 1;
+        }
+    }
+    return cnt;
+}
+
+int main(void) {
+    bench_input in;
+    if (bench_read_input(&in) != 0) {
+        return 1;
+    }
+
+    uint32_t cnt = word_count(in.data, in.len);
+
+    fwrite(&cnt, sizeof(uint32_t), 1, stdout);
+
+    bench_free_input(&in);
+    return 0;
+}
@@ -0,0 +1,31 @@
+#include <stdint.h>
+#include <stdio.h>
+
+#include "bench.h"
+
+int main(void) {
+    static uint8_t buf[BENCH_STREAM_CHUNK];
+    uint32_t cnt = 0;
+    /* Carried across chunks so a word split by a chunk edge counts once. */
+    int in_word = 0;
+
+    ssize_t n;
+    while ((n = bench_read_chunk(buf, sizeof buf)) > 0) {
+        for (ssize_t i = 0; i < n; i++) {
+            uint8_t ch = buf[i];
+            int is_space = (ch == 32 || ch == 10 || ch == 13 || ch == 9);
+            if (is_space) {
+                in_word = 0;
+            } else if (!in_word) {
+                cnt++;
+                in_word = 1;
+            }
+        }
+    }
+    if (n < 0) {
+        return 1;
+    }
+
+    fwrite(&cnt, sizeof(uint32_t), 1, stdout);
+    return 0;
+}
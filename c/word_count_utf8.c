@@ -0,0 +1,65 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bench.h"
+
+/*
+ * Byte length of the Unicode White_Space character at p[0, n), or 0.
+ * Matches the UTF-8 encodings directly: every other sequence, including
+ * invalid UTF-8, is part of a word.
+ */
+static size_t space_len(const uint8_t *p, size_t n) {
+    uint8_t c = p[0];
+    if (c < 0x80) {
+        return (c == 32 || (c >= 9 && c <= 13)) ? 1 : 0;
+    }
+    if (c == 0xC2) {
+        /* U+0085, U+00A0 */
+        return n >= 2 && (p[1] == 0x85 || p[1] == 0xA0) ? 2 : 0;
+    }
+    if (n < 3) {
+        return 0;
+    }
+    if (c == 0xE1) {
+        /* U+1680 */
+        return p[1] == 0x9A && p[2] == 0x80 ? 3 : 0;
+    }
+    if (c == 0xE2) {
+        /* U+2000..U+200A, U+2028, U+2029, U+202F, U+205F */
+        if (p[1] == 0x80) {
+            uint8_t d = p[2];
+            return (d >= 0x80 && d <= 0x8A) || d == 0xA8 || d == 0xA9 || d == 0xAF ? 3 : 0;
+        }
+        return p[1] == 0x81 && p[2] == 0x9F ? 3 : 0;
+    }
+    if (c == 0xE3) {
+        /* U+3000 */
+        return p[1] == 0x80 && p[2] == 0x80 ? 3 : 0;
+    }
+    return 0;
+}
+
+static int kernel(const uint8_t *input, size_t len, bench_output *out) {
+    uint32_t cnt = 0;
+    int in_word = 0;
+    size_t i = 0;
+
+    while (i < len) {
+        size_t w = space_len(input + i, len - i);
+        if (w > 0) {
+            in_word = 0;
+            i += w;
+            continue;
+        }
+        if (!in_word) {
+            cnt++;
+            in_word = 1;
+        }
+        i++;
+    }
+
+    return bench_output_u32(out, cnt);
+}
+
+int main(void) { return bench_main(kernel); }
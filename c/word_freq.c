@@ -0,0 +1,136 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+
+#define TOP_K 10
+
+typedef struct {
+    const uint8_t *word; /* points into the input */
+    uint32_t len;
+    uint32_t count;
+} entry;
+
+/*
+ * Open-addressing table of entry indexes (+1, so 0 is an empty slot) with
+ * linear probing. The capacity is a power of two and doubles before the
+ * table is half full.
+ */
+typedef struct {
+    uint32_t *slots;
+    uint32_t *hashes; /* hash of each slot's entry, compared before the bytes */
+    size_t cap;
+    entry *entries;
+    size_t n;
+    size_t entries_cap;
+} word_table;
+
+static uint32_t fnv1a(const uint8_t *p, size_t len) {
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < len; i++) {
+        h = (h ^ p[i]) * 16777619u;
+    }
+    return h;
+}
+
+static int table_grow(word_table *t) {
+    size_t cap = t->cap ? t->cap * 2 : 1024;
+    uint32_t *slots = calloc(cap, sizeof *slots);
+    uint32_t *hashes = malloc(cap * sizeof *hashes);
+    if (!slots || !hashes) {
+        free(slots);
+        free(hashes);
+        return -1;
+    }
+    for (size_t i = 0; i < t->cap; i++) {
+        if (!t->slots[i]) continue;
+        size_t s = t->hashes[i] & (cap - 1);
+        while (slots[s]) s = (s + 1) & (cap - 1);
+        slots[s] = t->slots[i];
+        hashes[s] = t->hashes[i];
+    }
+    free(t->slots);
+    free(t->hashes);
+    t->slots = slots;
+    t->hashes = hashes;
+    t->cap = cap;
+    return 0;
+}
+
+static int table_add(word_table *t, const uint8_t *word, size_t len) {
+    if ((t->n + 1) * 2 > t->cap && table_grow(t) != 0) {
+        return -1;
+    }
+    uint32_t h = fnv1a(word, len);
+    size_t s = h & (t->cap - 1);
+    while (t->slots[s]) {
+        entry *e = &t->entries[t->slots[s] - 1];
+        if (t->hashes[s] == h && e->len == len && memcmp(e->word, word, len) == 0) {
+            e->count++;
+            return 0;
+        }
+        s = (s + 1) & (t->cap - 1);
+    }
+
+    if (t->n == t->entries_cap) {
+        size_t cap = t->entries_cap ? t->entries_cap * 2 : 1024;
+        entry *grown = realloc(t->entries, cap * sizeof *grown);
+        if (!grown) return -1;
+        t->entries = grown;
+        t->entries_cap = cap;
+    }
+    t->entries[t->n] = (entry){word, (uint32_t)len, 1};
+    t->n++;
+    t->slots[s] = (uint32_t)t->n;
+    t->hashes[s] = h;
+    return 0;
+}
+
+/* Most frequent first; ties in byte order, a prefix before longer words. */
+static int entry_cmp(const void *pa, const void *pb) {
+    const entry *a = pa;
+    const entry *b = pb;
+    if (a->count != b->count) return a->count > b->count ? -1 : 1;
+    size_t m = a->len < b->len ? a->len : b->len;
+    int c = memcmp(a->word, b->word, m);
+    if (c != 0) return c;
+    return (a->len > b->len) - (a->len < b->len);
+}
+
+/*
+ * Input: text; words are separated by the whitespace word_count.c uses.
+ * Output: the distinct word count as u32 LE, then for each of the TOP_K
+ * most frequent words (fewer if there are fewer): count and byte length
+ * as u32 LE, followed by the word.
+ */
+static int kernel(const uint8_t *input, size_t len, bench_output *out) {
+    word_table t = {0};
+    int rc = 0;
+    size_t i = 0;
+
+    while (i < len && rc == 0) {
+        while (i < len && (input[i] == 32 || input[i] == 10 || input[i] == 13 || input[i] == 9)) i++;
+        size_t start = i;
+        while (i < len && !(input[i] == 32 || input[i] == 10 || input[i] == 13 || input[i] == 9)) i++;
+        if (i > start) rc = table_add(&t, input + start, i - start);
+    }
+
+    if (rc == 0) {
+        qsort(t.entries, t.n, sizeof *t.entries, entry_cmp);
+        rc = bench_output_u32(out, (uint32_t)t.n);
+        for (size_t k = 0; k < t.n && k < TOP_K && rc == 0; k++) {
+            const entry *e = &t.entries[k];
+            rc = bench_output_u32(out, e->count) || bench_output_u32(out, e->len) ||
+                 bench_output_write(out, e->word, e->len);
+        }
+    }
+
+    free(t.slots);
+    free(t.hashes);
+    free(t.entries);
+    return rc;
+}
+
+int main(void) { return bench_main(kernel); }
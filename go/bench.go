@@ -0,0 +1,115 @@
+// Shared harness for the Go benchmark programs. run_benchmarks.py builds
+// every program in this directory together with this file.
+//
+// benchMain reads all of stdin, times only the kernel call, and writes the
+// kernel's output to stdout. With BENCH_KERNEL_TIMING set it reports the
+// kernel time on stderr as "BENCH_KERNEL_NS <ns>", like c/bench.h. With
+// BENCH_SERVE set it answers a stream of requests instead (see benchServe).
+
+package main
+
+import (
+	"bufio"
+	"encoding/binary"
+	"fmt"
+	"io"
+	"os"
+	"strconv"
+	"time"
+)
+
+func benchMain(kernel func([]byte) ([]byte, error)) {
+	if _, ok := os.LookupEnv("BENCH_SERVE"); ok {
+		if err := benchServe(kernel); err != nil {
+			os.Exit(1)
+		}
+		return
+	}
+
+	input, err := io.ReadAll(os.Stdin)
+	if err != nil {
+		os.Exit(1)
+	}
+
+	start := time.Now()
+	out, err := kernel(input)
+	elapsed := time.Since(start)
+	if err != nil {
+		os.Exit(1)
+	}
+
+	if _, err := os.Stdout.Write(out); err != nil {
+		os.Exit(1)
+	}
+	benchReportKernelNs(elapsed.Nanoseconds())
+}
+
+// benchServe is the server-mode request loop: each request and response is
+// a u32 LE byte length followed by that many bytes (the X07 direct-binary
+// ABI). It returns nil at a clean EOF between requests.
+func benchServe(kernel func([]byte) ([]byte, error)) error {
+	r := bufio.NewReaderSize(os.Stdin, 1<<16)
+	w := bufio.NewWriterSize(os.Stdout, 1<<16)
+	var hdr [4]byte
+	var req []byte
+
+	for {
+		if _, err := io.ReadFull(r, hdr[:]); err != nil {
+			if err == io.EOF {
+				return nil
+			}
+			return err
+		}
+		n := int(binary.LittleEndian.Uint32(hdr[:]))
+		if cap(req) < n {
+			req = make([]byte, n)
+		}
+		req = req[:n]
+		if _, err := io.ReadFull(r, req); err != nil {
+			return err
+		}
+
+		out, err := kernel(req)
+		if err != nil {
+			return err
+		}
+		binary.LittleEndian.PutUint32(hdr[:], uint32(len(out)))
+		if _, err := w.Write(hdr[:]); err != nil {
+			return err
+		}
+		if _, err := w.Write(out); err != nil {
+			return err
+		}
+		if err := w.Flush(); err != nil {
+			return err
+		}
+	}
+}
+
+func benchReportKernelNs(ns int64) {
+	if _, ok := os.LookupEnv("BENCH_KERNEL_TIMING"); ok {
+		fmt.Fprintf(os.Stderr, "BENCH_KERNEL_NS %d\n", ns)
+	}
+}
+
+// benchThreadCount returns the worker count for the *_par programs from
+// argv[1], clamped to [1, 256] like bench_thread_count in c/bench.h.
+func benchThreadCount() int {
+	if len(os.Args) < 2 {
+		return 1
+	}
+	n, err := strconv.Atoi(os.Args[1])
+	if err != nil || n < 1 {
+		return 1
+	}
+	if n > 256 {
+		return 256
+	}
+	return n
+}
+
+// benchChunkStart is the start offset of chunk k when splitting n bytes into
+// parts nearly equal chunks.
+func benchChunkStart(n, parts, k int) int {
+	return (n/parts)*k + (n%parts)*k/parts
+}
@@ -1,17 +1,8 @@
 package main
 
-import (
-	"encoding/binary"
-	"io"
-	"os"
-)
-
-func main() {
-	input, err := io.ReadAll(os.Stdin)
-	if err != nil {
-		os.Exit(1)
-	}
+import "encoding/binary"
 
+func kernel(input []byte) ([]byte, error) {
 	var freq [256]uint32
 	for _, b := range input {
 		freq[b]++
@@ -27,8 +18,9 @@ func main() {
 		binary.LittleEndian.PutUint32(tmp[:], n)
 		out = append(out, tmp[:]...)
 	}
+	return out, nil
+}
 
-	if _, err := os.Stdout.Write(out); err != nil {
-		os.Exit(1)
-	}
+func main() {
+	benchMain(kernel)
 }
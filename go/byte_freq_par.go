@@ -0,0 +1,54 @@
+package main
+
+import (
+	"encoding/binary"
+	"io"
+	"os"
+	"sync"
+)
+
+func main() {
+	threads := benchThreadCount()
+
+	input, err := io.ReadAll(os.Stdin)
+	if err != nil {
+		os.Exit(1)
+	}
+
+	partial := make([][256]uint32, threads)
+	var wg sync.WaitGroup
+	for k := 0; k < threads; k++ {
+		wg.Add(1)
+		go func(k int) {
+			defer wg.Done()
+			var local [256]uint32
+			for _, b := range input[benchChunkStart(len(input), threads, k):benchChunkStart(len(input), threads, k+1)] {
+				local[b]++
+			}
+			partial[k] = local
+		}(k)
+	}
+	wg.Wait()
+
+	var freq [256]uint32
+	for _, local := range partial {
+		for i, n := range local {
+			freq[i] += n
+		}
+	}
+
+	out := make([]byte, 0, 256*5)
+	var tmp [4]byte
+	for i, n := range freq {
+		if n == 0 {
+			continue
+		}
+		out = append(out, byte(i))
+		binary.LittleEndian.PutUint32(tmp[:], n)
+		out = append(out, tmp[:]...)
+	}
+
+	if _, err := os.Stdout.Write(out); err != nil {
+		os.Exit(1)
+	}
+}
@@ -0,0 +1,42 @@
+package main
+
+import (
+	"encoding/binary"
+	"io"
+	"os"
+)
+
+const chunkSize = 64 * 1024
+
+func main() {
+	buf := make([]byte, chunkSize)
+	var freq [256]uint32
+
+	for {
+		n, err := os.Stdin.Read(buf)
+		for _, b := range buf[:n] {
+			freq[b]++
+		}
+		if err == io.EOF {
+			break
+		}
+		if err != nil {
+			os.Exit(1)
+		}
+	}
+
+	out := make([]byte, 0, 256*5)
+	var tmp [4]byte
+	for i, n := range freq {
+		if n == 0 {
+			continue
+		}
+		out = append(out, byte(i))
+		binary.LittleEndian.PutUint32(tmp[:], n)
+		out = append(out, tmp[:]...)
+	}
+
+	if _, err := os.Stdout.Write(out); err != nil {
+		os.Exit(1)
+	}
+}
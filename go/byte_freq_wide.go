@@ -0,0 +1,26 @@
+package main
+
+import "encoding/binary"
+
+func kernel(input []byte) ([]byte, error) {
+	var freq [256]uint64
+	for _, b := range input {
+		freq[b]++
+	}
+
+	out := make([]byte, 0, 256*9)
+	var tmp [8]byte
+	for i, n := range freq {
+		if n == 0 {
+			continue
+		}
+		out = append(out, byte(i))
+		binary.LittleEndian.PutUint64(tmp[:], n)
+		out = append(out, tmp[:]...)
+	}
+	return out, nil
+}
+
+func main() {
+	benchMain(kernel)
+}
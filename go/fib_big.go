@@ -0,0 +1,97 @@
+package main
+
+import (
+	"encoding/binary"
+	"errors"
+)
+
+// Little-endian base 2^32 limbs with no leading zero limbs, as in
+// c/fib_big.c. math/big would multiply with Karatsuba; these stay
+// schoolbook so every language runs the same algorithm.
+
+func bigTrim(x []uint32) []uint32 {
+	for len(x) > 0 && x[len(x)-1] == 0 {
+		x = x[:len(x)-1]
+	}
+	return x
+}
+
+func bigAdd(x, y []uint32) []uint32 {
+	if len(x) < len(y) {
+		x, y = y, x
+	}
+	r := make([]uint32, len(x)+1)
+	var carry uint64
+	for i := range x {
+		s := carry + uint64(x[i])
+		if i < len(y) {
+			s += uint64(y[i])
+		}
+		r[i] = uint32(s)
+		carry = s >> 32
+	}
+	r[len(x)] = uint32(carry)
+	return bigTrim(r)
+}
+
+// bigSub returns x - y for x >= y.
+func bigSub(x, y []uint32) []uint32 {
+	r := make([]uint32, len(x))
+	var borrow uint64
+	for i := range x {
+		s := uint64(x[i]) - borrow
+		if i < len(y) {
+			s -= uint64(y[i])
+		}
+		r[i] = uint32(s)
+		borrow = s >> 63
+	}
+	return bigTrim(r)
+}
+
+func bigMul(x, y []uint32) []uint32 {
+	r := make([]uint32, len(x)+len(y))
+	for i, xi := range x {
+		var carry uint64
+		for j, yj := range y {
+			t := uint64(r[i+j]) + uint64(xi)*uint64(yj) + carry
+			r[i+j] = uint32(t)
+			carry = t >> 32
+		}
+		r[i+len(y)] = uint32(carry)
+	}
+	return bigTrim(r)
+}
+
+func kernel(input []byte) ([]byte, error) {
+	if len(input) < 4 {
+		return nil, errors.New("fib_big: input shorter than 4 bytes")
+	}
+	n := binary.LittleEndian.Uint32(input[:4])
+
+	// Fast doubling with (a, b) = (F(k), F(k+1)); see c/fib_big.c.
+	a := []uint32{}
+	b := []uint32{1}
+	for bit := 31; bit >= 0; bit-- {
+		c := bigMul(a, bigSub(bigAdd(b, b), a))
+		d := bigAdd(bigMul(a, a), bigMul(b, b))
+		if (n>>uint(bit))&1 == 1 {
+			a, b = d, bigAdd(c, d)
+		} else {
+			a, b = c, d
+		}
+	}
+
+	out := make([]byte, 4*len(a))
+	for i, limb := range a {
+		binary.LittleEndian.PutUint32(out[4*i:], limb)
+	}
+	for len(out) > 0 && out[len(out)-1] == 0 {
+		out = out[:len(out)-1]
+	}
+	return out, nil
+}
+
+func main() {
+	benchMain(kernel)
+}
@@ -2,17 +2,12 @@ package main
 
 import (
 	"encoding/binary"
-	"io"
-	"os"
+	"errors"
 )
 
-func main() {
-	input, err := io.ReadAll(os.Stdin)
-	if err != nil {
-		os.Exit(1)
-	}
+func kernel(input []byte) ([]byte, error) {
 	if len(input) < 4 {
-		os.Exit(1)
+		return nil, errors.New("fibonacci: input shorter than 4 bytes")
 	}
 
 	n := binary.LittleEndian.Uint32(input[:4])
@@ -30,9 +25,11 @@ func main() {
 		result = b
 	}
 
-	var out [4]byte
-	binary.LittleEndian.PutUint32(out[:], result)
-	if _, err := os.Stdout.Write(out[:]); err != nil {
-		os.Exit(1)
-	}
+	out := make([]byte, 4)
+	binary.LittleEndian.PutUint32(out, result)
+	return out, nil
+}
+
+func main() {
+	benchMain(kernel)
 }
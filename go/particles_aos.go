@@ -0,0 +1,53 @@
+package main
+
+import "encoding/binary"
+
+const particleSteps = 16
+
+type particle struct {
+	x, y, z    uint32
+	vx, vy, vz uint32
+	mass       uint32
+	id         uint32
+}
+
+func kernel(input []byte) ([]byte, error) {
+	ps := make([]particle, len(input)/32)
+	for i := range ps {
+		r := input[32*i : 32*i+32]
+		ps[i] = particle{
+			x: binary.LittleEndian.Uint32(r[0:]), y: binary.LittleEndian.Uint32(r[4:]),
+			z: binary.LittleEndian.Uint32(r[8:]), vx: binary.LittleEndian.Uint32(r[12:]),
+			vy: binary.LittleEndian.Uint32(r[16:]), vz: binary.LittleEndian.Uint32(r[20:]),
+			mass: binary.LittleEndian.Uint32(r[24:]), id: binary.LittleEndian.Uint32(r[28:]),
+		}
+	}
+
+	for step := 0; step < particleSteps; step++ {
+		for i := range ps {
+			p := &ps[i]
+			p.x += p.vx
+			p.y += p.vy
+			p.z += p.vz
+		}
+	}
+
+	var mass, pos uint32
+	for i := range ps {
+		p := &ps[i]
+		if p.x < p.y {
+			mass += p.mass
+		}
+		pos += p.x + p.y + p.z
+	}
+
+	out := make([]byte, 12)
+	binary.LittleEndian.PutUint32(out[0:], uint32(len(ps)))
+	binary.LittleEndian.PutUint32(out[4:], mass)
+	binary.LittleEndian.PutUint32(out[8:], pos)
+	return out, nil
+}
+
+func main() {
+	benchMain(kernel)
+}
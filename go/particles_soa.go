@@ -0,0 +1,53 @@
+package main
+
+import "encoding/binary"
+
+const particleSteps = 16
+
+// One slice per record field, in input order.
+type particles struct {
+	x, y, z    []uint32
+	vx, vy, vz []uint32
+	mass       []uint32
+	id         []uint32
+}
+
+func kernel(input []byte) ([]byte, error) {
+	n := len(input) / 32
+	cols := make([][]uint32, 8)
+	for f := range cols {
+		cols[f] = make([]uint32, n)
+	}
+	for i := 0; i < n; i++ {
+		for f := range cols {
+			cols[f][i] = binary.LittleEndian.Uint32(input[32*i+4*f:])
+		}
+	}
+	ps := particles{cols[0], cols[1], cols[2], cols[3], cols[4], cols[5], cols[6], cols[7]}
+
+	for step := 0; step < particleSteps; step++ {
+		for i := 0; i < n; i++ {
+			ps.x[i] += ps.vx[i]
+			ps.y[i] += ps.vy[i]
+			ps.z[i] += ps.vz[i]
+		}
+	}
+
+	var mass, pos uint32
+	for i := 0; i < n; i++ {
+		if ps.x[i] < ps.y[i] {
+			mass += ps.mass[i]
+		}
+		pos += ps.x[i] + ps.y[i] + ps.z[i]
+	}
+
+	out := make([]byte, 12)
+	binary.LittleEndian.PutUint32(out[0:], uint32(n))
+	binary.LittleEndian.PutUint32(out[4:], mass)
+	binary.LittleEndian.PutUint32(out[8:], pos)
+	return out, nil
+}
+
+func main() {
+	benchMain(kernel)
+}
@@ -0,0 +1,25 @@
+package main
+
+func kernel(input []byte) ([]byte, error) {
+	pairs := len(input) / 2
+	total := 0
+	for i := 0; i < pairs; i++ {
+		total += int(input[2*i])
+	}
+
+	out := make([]byte, total)
+	pos := 0
+	for i := 0; i < pairs; i++ {
+		run := out[pos : pos+int(input[2*i])]
+		b := input[2*i+1]
+		for j := range run {
+			run[j] = b
+		}
+		pos += len(run)
+	}
+	return out, nil
+}
+
+func main() {
+	benchMain(kernel)
+}
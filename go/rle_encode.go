@@ -1,17 +1,8 @@
 package main
 
-import (
-	"io"
-	"os"
-)
-
-func main() {
-	input, err := io.ReadAll(os.Stdin)
-	if err != nil {
-		os.Exit(1)
-	}
+func kernel(input []byte) ([]byte, error) {
 	if len(input) == 0 {
-		return
+		return nil, nil
 	}
 
 	out := make([]byte, 0, len(input)*2)
@@ -35,8 +26,9 @@ func main() {
 	}
 
 	out = append(out, cnt, cur)
+	return out, nil
+}
 
-	if _, err := os.Stdout.Write(out); err != nil {
-		os.Exit(1)
-	}
+func main() {
+	benchMain(kernel)
 }
@@ -0,0 +1,77 @@
+package main
+
+import (
+	"io"
+	"os"
+	"sync"
+)
+
+func encode(input []byte) []byte {
+	if len(input) == 0 {
+		return nil
+	}
+
+	out := make([]byte, 0, len(input)*2)
+	cur := input[0]
+	var cnt byte = 1
+
+	for i := 1; i < len(input); i++ {
+		x := input[i]
+		if x == cur {
+			if cnt < 255 {
+				cnt++
+				continue
+			}
+			out = append(out, cnt, cur)
+			cnt = 1
+			continue
+		}
+		out = append(out, cnt, cur)
+		cur = x
+		cnt = 1
+	}
+
+	return append(out, cnt, cur)
+}
+
+func main() {
+	threads := benchThreadCount()
+
+	input, err := io.ReadAll(os.Stdin)
+	if err != nil {
+		os.Exit(1)
+	}
+	n := len(input)
+
+	// Chunk edges are pushed forward to the next run boundary, so every chunk
+	// encodes independently and the concatenation matches the serial output.
+	bounds := make([]int, threads+1)
+	for k := 1; k < threads; k++ {
+		b := benchChunkStart(n, threads, k)
+		if b < bounds[k-1] {
+			b = bounds[k-1]
+		}
+		for b > 0 && b < n && input[b] == input[b-1] {
+			b++
+		}
+		bounds[k] = b
+	}
+	bounds[threads] = n
+
+	parts := make([][]byte, threads)
+	var wg sync.WaitGroup
+	for k := 0; k < threads; k++ {
+		wg.Add(1)
+		go func(k int) {
+			defer wg.Done()
+			parts[k] = encode(input[bounds[k]:bounds[k+1]])
+		}(k)
+	}
+	wg.Wait()
+
+	for _, part := range parts {
+		if _, err := os.Stdout.Write(part); err != nil {
+			os.Exit(1)
+		}
+	}
+}
@@ -0,0 +1,61 @@
+package main
+
+import (
+	"io"
+	"os"
+)
+
+const chunkSize = 64 * 1024
+
+func main() {
+	buf := make([]byte, chunkSize)
+	out := make([]byte, 0, chunkSize*2)
+
+	// The open run is carried across chunk edges and only emitted once it ends.
+	haveRun := false
+	var cur, cnt byte
+
+	for {
+		n, err := os.Stdin.Read(buf)
+		chunk := buf[:n]
+		if n > 0 && !haveRun {
+			cur = chunk[0]
+			cnt = 1
+			haveRun = true
+			chunk = chunk[1:]
+		}
+
+		for _, x := range chunk {
+			if x == cur {
+				if cnt < 255 {
+					cnt++
+					continue
+				}
+				out = append(out, cnt, cur)
+				cnt = 1
+				continue
+			}
+			out = append(out, cnt, cur)
+			cur = x
+			cnt = 1
+		}
+
+		if _, werr := os.Stdout.Write(out); werr != nil {
+			os.Exit(1)
+		}
+		out = out[:0]
+
+		if err == io.EOF {
+			break
+		}
+		if err != nil {
+			os.Exit(1)
+		}
+	}
+
+	if haveRun {
+		if _, err := os.Stdout.Write([]byte{cnt, cur}); err != nil {
+			os.Exit(1)
+		}
+	}
+}
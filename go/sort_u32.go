@@ -0,0 +1,28 @@
+package main
+
+import (
+	"encoding/binary"
+	"slices"
+)
+
+func kernel(input []byte) ([]byte, error) {
+	values := make([]uint32, len(input)/4)
+	for i := range values {
+		values[i] = binary.LittleEndian.Uint32(input[4*i:])
+	}
+	slices.Sort(values)
+
+	var sum uint32
+	for i, v := range values {
+		sum += uint32(i+1) * v
+	}
+
+	out := make([]byte, 8)
+	binary.LittleEndian.PutUint32(out[0:], uint32(len(values)))
+	binary.LittleEndian.PutUint32(out[4:], sum)
+	return out, nil
+}
+
+func main() {
+	benchMain(kernel)
+}
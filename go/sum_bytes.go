@@ -1,25 +1,18 @@
 package main
 
-import (
-	"encoding/binary"
-	"io"
-	"os"
-)
-
-func main() {
-	input, err := io.ReadAll(os.Stdin)
-	if err != nil {
-		os.Exit(1)
-	}
+import "encoding/binary"
 
+func kernel(input []byte) ([]byte, error) {
 	var acc uint32
 	for _, b := range input {
 		acc += uint32(b)
 	}
 
-	var out [4]byte
-	binary.LittleEndian.PutUint32(out[:], acc)
-	if _, err := os.Stdout.Write(out[:]); err != nil {
-		os.Exit(1)
-	}
+	out := make([]byte, 4)
+	binary.LittleEndian.PutUint32(out, acc)
+	return out, nil
+}
+
+func main() {
+	benchMain(kernel)
 }
@@ -0,0 +1,43 @@
+package main
+
+import (
+	"encoding/binary"
+	"io"
+	"os"
+	"sync"
+)
+
+func main() {
+	threads := benchThreadCount()
+
+	input, err := io.ReadAll(os.Stdin)
+	if err != nil {
+		os.Exit(1)
+	}
+
+	partial := make([]uint32, threads)
+	var wg sync.WaitGroup
+	for k := 0; k < threads; k++ {
+		wg.Add(1)
+		go func(k int) {
+			defer wg.Done()
+			var acc uint32
+			for _, b := range input[benchChunkStart(len(input), threads, k):benchChunkStart(len(input), threads, k+1)] {
+				acc += uint32(b)
+			}
+			partial[k] = acc
+		}(k)
+	}
+	wg.Wait()
+
+	var acc uint32
+	for _, p := range partial {
+		acc += p
+	}
+
+	var out [4]byte
+	binary.LittleEndian.PutUint32(out[:], acc)
+	if _, err := os.Stdout.Write(out[:]); err != nil {
+		os.Exit(1)
+	}
+}
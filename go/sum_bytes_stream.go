@@ -0,0 +1,33 @@
+package main
+
+import (
+	"encoding/binary"
+	"io"
+	"os"
+)
+
+const chunkSize = 64 * 1024
+
+func main() {
+	buf := make([]byte, chunkSize)
+	var acc uint32
+
+	for {
+		n, err := os.Stdin.Read(buf)
+		for _, b := range buf[:n] {
+			acc += uint32(b)
+		}
+		if err == io.EOF {
+			break
+		}
+		if err != nil {
+			os.Exit(1)
+		}
+	}
+
+	var out [4]byte
+	binary.LittleEndian.PutUint32(out[:], acc)
+	if _, err := os.Stdout.Write(out[:]); err != nil {
+		os.Exit(1)
+	}
+}
@@ -1,21 +1,12 @@
 package main
 
-import (
-	"encoding/binary"
-	"io"
-	"os"
-)
+import "encoding/binary"
 
 func isSpace(b byte) bool {
 	return b == 32 || b == 10 || b == 13 || b == 9
 }
 
-func main() {
-	input, err := io.ReadAll(os.Stdin)
-	if err != nil {
-		os.Exit(1)
-	}
-
+func kernel(input []byte) ([]byte, error) {
 	var cnt uint32
 	inWord := false
 	for _, ch := range input {
@@ -29,9 +20,11 @@ func main() {
 		}
 	}
 
-	var out [4]byte
-	binary.LittleEndian.PutUint32(out[:], cnt)
-	if _, err := os.Stdout.Write(out[:]); err != nil {
-		os.Exit(1)
-	}
+	out := make([]byte, 4)
+	binary.LittleEndian.PutUint32(out, cnt)
+	return out, nil
+}
+
+func main() {
+	benchMain(kernel)
 }
@@ -0,0 +1,60 @@
+package main
+
+import (
+	"encoding/binary"
+	"io"
+	"os"
+	"sync"
+)
+
+func isSpace(b byte) bool {
+	return b == 32 || b == 10 || b == 13 || b == 9
+}
+
+// countWords counts word starts in [start, end); the byte before start decides the first one.
+func countWords(input []byte, start, end int) uint32 {
+	var cnt uint32
+	inWord := start > 0 && !isSpace(input[start-1])
+	for _, ch := range input[start:end] {
+		if isSpace(ch) {
+			inWord = false
+			continue
+		}
+		if !inWord {
+			cnt++
+			inWord = true
+		}
+	}
+	return cnt
+}
+
+func main() {
+	threads := benchThreadCount()
+
+	input, err := io.ReadAll(os.Stdin)
+	if err != nil {
+		os.Exit(1)
+	}
+
+	partial := make([]uint32, threads)
+	var wg sync.WaitGroup
+	for k := 0; k < threads; k++ {
+		wg.Add(1)
+		go func(k int) {
+			defer wg.Done()
+			partial[k] = countWords(input, benchChunkStart(len(input), threads, k), benchChunkStart(len(input), threads, k+1))
+		}(k)
+	}
+	wg.Wait()
+
+	var cnt uint32
+	for _, p := range partial {
+		cnt += p
+	}
+
+	var out [4]byte
+	binary.LittleEndian.PutUint32(out[:], cnt)
+	if _, err := os.Stdout.Write(out[:]); err != nil {
+		os.Exit(1)
+	}
+}
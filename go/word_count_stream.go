@@ -0,0 +1,46 @@
+package main
+
+import (
+	"encoding/binary"
+	"io"
+	"os"
+)
+
+const chunkSize = 64 * 1024
+
+func isSpace(b byte) bool {
+	return b == 32 || b == 10 || b == 13 || b == 9
+}
+
+func main() {
+	buf := make([]byte, chunkSize)
+	var cnt uint32
+	// Carried across chunks so a word split by a chunk edge counts once.
+	inWord := false
+
+	for {
+		n, err := os.Stdin.Read(buf)
+		for _, ch := range buf[:n] {
+			if isSpace(ch) {
+				inWord = false
+				continue
+			}
+			if !inWord {
+				cnt++
+				inWord = true
+			}
+		}
+		if err == io.EOF {
+			break
+		}
+		if err != nil {
+			os.Exit(1)
+		}
+	}
+
+	var out [4]byte
+	binary.LittleEndian.PutUint32(out[:], cnt)
+	if _, err := os.Stdout.Write(out[:]); err != nil {
+		os.Exit(1)
+	}
+}
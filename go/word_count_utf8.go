@@ -0,0 +1,33 @@
+package main
+
+import (
+	"encoding/binary"
+	"unicode"
+	"unicode/utf8"
+)
+
+func kernel(input []byte) ([]byte, error) {
+	var cnt uint32
+	inWord := false
+	for i := 0; i < len(input); {
+		r, w := utf8.DecodeRune(input[i:])
+		i += w
+		// Invalid bytes decode as RuneError, which is not a space.
+		if unicode.IsSpace(r) {
+			inWord = false
+			continue
+		}
+		if !inWord {
+			cnt++
+			inWord = true
+		}
+	}
+
+	out := make([]byte, 4)
+	binary.LittleEndian.PutUint32(out, cnt)
+	return out, nil
+}
+
+func main() {
+	benchMain(kernel)
+}
@@ -0,0 +1,61 @@
+package main
+
+import (
+	"encoding/binary"
+	"slices"
+	"strings"
+)
+
+const wordFreqTopK = 10
+
+type wordCount struct {
+	word  string
+	count uint32
+}
+
+func isWordSpace(b byte) bool {
+	return b == ' ' || b == '\n' || b == '\r' || b == '\t'
+}
+
+// Output format as in c/word_freq.c.
+func kernel(input []byte) ([]byte, error) {
+	counts := make(map[string]uint32)
+	for i := 0; i < len(input); {
+		for i < len(input) && isWordSpace(input[i]) {
+			i++
+		}
+		start := i
+		for i < len(input) && !isWordSpace(input[i]) {
+			i++
+		}
+		if i > start {
+			counts[string(input[start:i])]++
+		}
+	}
+
+	entries := make([]wordCount, 0, len(counts))
+	for w, c := range counts {
+		entries = append(entries, wordCount{w, c})
+	}
+	slices.SortFunc(entries, func(a, b wordCount) int {
+		if a.count != b.count {
+			if a.count > b.count {
+				return -1
+			}
+			return 1
+		}
+		return strings.Compare(a.word, b.word)
+	})
+
+	out := binary.LittleEndian.AppendUint32(nil, uint32(len(entries)))
+	for _, e := range entries[:min(wordFreqTopK, len(entries))] {
+		out = binary.LittleEndian.AppendUint32(out, e.count)
+		out = binary.LittleEndian.AppendUint32(out, uint32(len(e.word)))
+		out = append(out, e.word...)
+	}
+	return out, nil
+}
+
+func main() {
+	benchMain(kernel)
+}
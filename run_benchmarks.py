@@ -8,19 +8,31 @@ across multiple languages.
 from __future__ import annotations
 
 import argparse
+import contextlib
+import functools
+import gzip
+import hashlib
 import json
+import math
 import os
+import platform
+import queue
 import random
+import re
+import shlex
 import shutil
 import statistics
 import struct
 import subprocess
 import sys
+import tarfile
 import tempfile
+import threading
 import time
-from dataclasses import dataclass, field
+from concurrent.futures import ThreadPoolExecutor
+from dataclasses import dataclass, field, replace
 from pathlib import Path
-from typing import Any
+from typing import Any, Callable
 
 
 def _perf_repo_root() -> Path:
@@ -34,6 +46,46 @@ def _x07_host_runner_prefix(host_runner: Path, cc_profile: str) -> list[str]:
     return cmd
 
 
+def _x07_prefixed(data: bytes) -> bytes:
+    """Frame input for a direct X07 binary: u32 LE length, then the bytes."""
+    return struct.pack("<I", len(data)) + data
+
+
+def _x07_framed(inp: bytes | Path) -> bytes | Path:
+    """Frame raw input bytes for a direct X07 binary.
+
+    A Path is passed through: it names a file InputCache already wrote in
+    the framed layout (see InputData.x07_stdin).
+    """
+    return inp if isinstance(inp, Path) else _x07_prefixed(inp)
+
+
+def _x07_unframed(raw: bytes) -> bytes:
+    """The payload of a direct X07 binary's length-prefixed output."""
+    if len(raw) < 4:
+        raise RuntimeError(f"X07 output too short: {len(raw)} bytes")
+    out_len = struct.unpack("<I", raw[:4])[0]
+    if len(raw) < 4 + out_len:
+        raise RuntimeError(f"X07 output truncated: expected {out_len}, got {len(raw) - 4}")
+    return raw[4:4 + out_len]
+
+
+@contextlib.contextmanager
+def _stdin(inp: bytes | Path):
+    """subprocess.run keyword arguments that feed `inp` to the child's stdin.
+
+    A Path is redirected as the child's stdin, so the program reads (or
+    maps) the file itself instead of the runner writing it through a pipe.
+    Enter this before starting the clock: opening the file is not the
+    program's work.
+    """
+    if isinstance(inp, Path):
+        with open(inp, "rb") as f:
+            yield {"stdin": f}
+    else:
+        yield {"input": inp}
+
+
 def _is_executable(path: Path) -> bool:
     return path.is_file() and os.access(path, os.X_OK)
 
@@ -137,24 +189,34 @@ def _parse_time_max_rss_kb(stderr: bytes) -> int:
 
 def _run_with_optional_rss(
     cmd: list[str],
-    input_data: bytes,
+    input_data: bytes | Path,
     cwd: Path | None = None,
     env: dict[str, str] | None = None,
     measure_rss: bool = False,
-) -> tuple[subprocess.CompletedProcess[bytes], int]:
+) -> tuple[subprocess.CompletedProcess[bytes], int | None]:
+    """Run `cmd` once, with its peak RSS in KiB when `measure_rss` is set.
+
+    Without /usr/bin/time the peak comes from sampling (see _MemorySampler),
+    which misses programs that exit before the first sample; their peak is
+    None (not measured) rather than 0.
+    """
     rss_kb = 0
     wrapped = cmd
     time_bin = _time_bin() if measure_rss else None
     if time_bin:
         wrapped = time_bin + cmd
-
-    res = subprocess.run(
-        wrapped,
-        input=input_data,
-        capture_output=True,
-        cwd=str(cwd) if cwd else None,
-        env=env,
-    )
+    elif measure_rss and _HAVE_PROC_STATUS:
+        res, _, profile = _run_memory_sampled(cmd, input_data, None, env=env, cwd=cwd)
+        return res, profile["max_rss_kb"]
+
+    with _stdin(input_data) as stdin:
+        res = subprocess.run(
+            wrapped,
+            **stdin,
+            capture_output=True,
+            cwd=str(cwd) if cwd else None,
+            env=env,
+        )
 
     if time_bin:
         rss_kb = _parse_time_max_rss_kb(res.stderr)
@@ -162,16 +224,530 @@ def _run_with_optional_rss(
     return res, rss_kb
 
 
+def _run_rusage(
+    cmd: list[str],
+    input_data: bytes | Path,
+    cwd: Path | None = None,
+    env: dict[str, str] | None = None,
+    on_start: Callable[[int], None] | None = None,
+) -> tuple[subprocess.CompletedProcess[bytes], Any, float]:
+    """Run `cmd` and reap it with wait4(2): its result, rusage and wall time (ms).
+
+    `on_start(pid)` is called as soon as the child exists, e.g. to start
+    sampling it. The time covers the same span as subprocess.run: from the
+    spawn until the output is drained and the child reaped.
+    """
+    with _stdin(input_data) as stdin:
+        start = time.perf_counter()
+        proc = subprocess.Popen(
+            cmd,
+            stdin=stdin.get("stdin", subprocess.PIPE),
+            stdout=subprocess.PIPE,
+            stderr=subprocess.PIPE,
+            cwd=str(cwd) if cwd else None,
+            env=env,
+        )
+        if on_start is not None:
+            on_start(proc.pid)
+        drained: dict[str, bytes] = {}
+
+        def drain(name: str, pipe: Any) -> None:
+            drained[name] = pipe.read()
+            pipe.close()
+
+        workers = [
+            threading.Thread(target=drain, args=("stdout", proc.stdout)),
+            threading.Thread(target=drain, args=("stderr", proc.stderr)),
+        ]
+        if "input" in stdin:
+            workers.append(threading.Thread(target=_feed, args=(proc.stdin, stdin["input"])))
+        for w in workers:
+            w.start()
+        _, status, rusage = os.wait4(proc.pid, 0)
+        proc.returncode = os.waitstatus_to_exitcode(status)
+        for w in workers:
+            w.join()
+        run_time = (time.perf_counter() - start) * 1000
+
+    res = subprocess.CompletedProcess(cmd, proc.returncode, drained["stdout"], drained["stderr"])
+    return res, rusage, run_time
+
+
+# --memory: how often a child's /proc/<pid>/status is read, and the fields
+# kept from it (KiB). RssAnon is heap, stacks and anonymous mmaps; RssFile
+# is the binary, shared libraries and mapped files such as the C-io input.
+MEMORY_SAMPLE_INTERVAL_S = 0.001
+_STATUS_FIELDS = ("VmRSS", "RssAnon", "RssFile")
+_HAVE_PROC_STATUS = os.path.exists("/proc/self/status")
+
+
+class _MemorySampler:
+    """Polls a child's /proc/<pid>/status into [ms, rss, anon, file] samples.
+
+    The polling thread moves itself off `core`, so with --pin it does not
+    compete with the measured process. Without /proc (macOS) it records
+    nothing, and only the rusage numbers are available.
+
+    `hwm_kb` is the last VmHWM seen. It is the peak RSS up to that sample,
+    unlike the child's ru_maxrss, which on Linux starts from the forking
+    runner's own peak.
+    """
+
+    def __init__(self, core: int | None):
+        self.core = core
+        self.samples: list[list[float]] = []
+        self.hwm_kb: int | None = None
+        self._done = threading.Event()
+        self._thread: threading.Thread | None = None
+        self._start = 0.0
+
+    def start(self, pid: int, program: str) -> None:
+        self._start = time.perf_counter()
+        self._thread = threading.Thread(target=self._poll, args=(pid, program), daemon=True)
+        self._thread.start()
+
+    def stop(self) -> None:
+        self._done.set()
+        if self._thread is not None:
+            self._thread.join()
+
+    def _poll(self, pid: int, program: str) -> None:
+        if self.core is not None and hasattr(os, "sched_setaffinity"):
+            others = set(range(os.cpu_count() or 1)) - {self.core}
+            with contextlib.suppress(OSError):
+                if others:
+                    os.sched_setaffinity(0, others)
+        path = f"/proc/{pid}/status"
+        while not self._done.is_set():
+            try:
+                with open(path) as f:
+                    txt = f.read()
+            except OSError:
+                return
+            vals = {}
+            name = ""
+            for line in txt.splitlines():
+                key, _, rest = line.partition(":")
+                if key in _STATUS_FIELDS or key == "VmHWM":
+                    vals[key] = int(rest.split()[0])
+                elif key == "Name":
+                    name = rest.strip()
+            # Until the exec, the child still reports the runner's memory.
+            if name != Path(program).name[:15]:
+                self._done.wait(MEMORY_SAMPLE_INTERVAL_S / 10)
+                continue
+            # An exited child (a zombie until reaped) has no VmRSS line.
+            if "VmRSS" not in vals:
+                return
+            ms = (time.perf_counter() - self._start) * 1000
+            self.hwm_kb = vals.get("VmHWM", self.hwm_kb)
+            self.samples.append([round(ms, 3)] + [vals.get(k, 0) for k in _STATUS_FIELDS])
+            self._done.wait(MEMORY_SAMPLE_INTERVAL_S)
+
+
+def _run_memory_sampled(
+    cmd: list[str],
+    input_data: bytes | Path,
+    core: int | None,
+    env: dict[str, str] | None = None,
+    cwd: Path | None = None,
+) -> tuple[subprocess.CompletedProcess[bytes], float, dict[str, Any]]:
+    """One --memory run: the result, wall time (ms) and the run's memory profile."""
+    sampler = _MemorySampler(core)
+    try:
+        res, rusage, run_time = _run_rusage(
+            cmd, input_data, cwd=cwd, env=env, on_start=lambda pid: sampler.start(pid, cmd[0])
+        )
+    finally:
+        sampler.stop()
+    samples = sampler.samples
+    if _HAVE_PROC_STATUS:
+        max_rss_kb = sampler.hwm_kb
+    else:
+        # macOS reports ru_maxrss in bytes.
+        max_rss_kb = rusage.ru_maxrss // 1024 if sys.platform == "darwin" else rusage.ru_maxrss
+    profile: dict[str, Any] = {
+        "minor_faults": rusage.ru_minflt,
+        "major_faults": rusage.ru_majflt,
+        "max_rss_kb": max_rss_kb,
+        "peak_anon_kb": max((s[2] for s in samples), default=None),
+        "peak_file_kb": max((s[3] for s in samples), default=None),
+        "timeline": samples,
+    }
+    return res, run_time, profile
+
+
+# Hardware/software events requested from `perf stat` (Linux), mapped to the
+# counter names used in results. Events the PMU cannot count (common in VMs)
+# are simply left out of the result.
+PERF_EVENTS: dict[str, str] = {
+    "cycles": "cycles",
+    "instructions": "instructions",
+    "branches": "branches",
+    "branch-misses": "branch_misses",
+    "LLC-loads": "llc_loads",
+    "LLC-load-misses": "llc_load_misses",
+    "page-faults": "page_faults",
+    "minor-faults": "minor_faults",
+    "major-faults": "major_faults",
+}
+
+# `/usr/bin/time -l` lines (macOS) carrying counters. kperf itself needs
+# root and a private framework, so this is what a plain child process gets.
+_DARWIN_TIME_COUNTERS: dict[str, str] = {
+    "instructions retired": "instructions",
+    "cycles elapsed": "cycles",
+    "page reclaims": "minor_faults",
+    "page faults": "major_faults",
+}
+
+
+def _counters_available() -> bool:
+    if sys.platform == "darwin":
+        return _time_bin() is not None
+    return sys.platform.startswith("linux") and shutil.which("perf") is not None
+
+
+def _parse_perf_stat_csv(txt: str) -> dict[str, float]:
+    """Parse `perf stat -x,` output into counter values.
+
+    Hybrid CPUs report one line per core type (`cpu_core/cycles/`,
+    `cpu_atom/cycles/`); those are summed.
+    """
+    counters: dict[str, float] = {}
+    for line in txt.splitlines():
+        parts = line.split(",")
+        if len(parts) < 3 or line.startswith("#"):
+            continue
+        value, event = parts[0].strip(), parts[2].strip()
+        event = event.rstrip("/").rsplit("/", 1)[-1].split(":", 1)[0]
+        name = PERF_EVENTS.get(event)
+        if name is None:
+            continue
+        try:
+            counters[name] = counters.get(name, 0.0) + float(value)
+        except ValueError:
+            # <not supported> / <not counted>
+            continue
+    return counters
+
+
+def _parse_darwin_time_counters(stderr: bytes) -> dict[str, float]:
+    counters: dict[str, float] = {}
+    for line in stderr.decode(errors="replace").splitlines():
+        parts = line.strip().split(None, 1)
+        if len(parts) != 2 or parts[1] not in _DARWIN_TIME_COUNTERS:
+            continue
+        try:
+            counters[_DARWIN_TIME_COUNTERS[parts[1]]] = float(parts[0])
+        except ValueError:
+            continue
+    if "minor_faults" in counters or "major_faults" in counters:
+        counters["page_faults"] = counters.get("minor_faults", 0.0) + counters.get(
+            "major_faults", 0.0
+        )
+    return counters
+
+
+def _derive_counter_ratios(counters: dict[str, float]) -> dict[str, float]:
+    """Add IPC and miss rates to raw counter values where both sides exist."""
+    if counters.get("cycles") and "instructions" in counters:
+        counters["ipc"] = counters["instructions"] / counters["cycles"]
+    if counters.get("branches") and "branch_misses" in counters:
+        counters["branch_miss_rate"] = counters["branch_misses"] / counters["branches"]
+    if counters.get("llc_loads") and "llc_load_misses" in counters:
+        counters["llc_miss_rate"] = counters["llc_load_misses"] / counters["llc_loads"]
+    return counters
+
+
+def _counter_run_failed(what: str, cmd: list[str], stderr: bytes) -> dict[str, float]:
+    # Usually perf_event_paranoid or a VM without a PMU; the timing row still counts.
+    lines = stderr.decode(errors="replace").strip().splitlines()
+    detail = f": {lines[-1]}" if lines else ""
+    print(f"warning: {what} failed for {Path(cmd[0]).name}, no counters{detail}", file=sys.stderr)
+    return {}
+
+
+def _run_with_counters(
+    cmd: list[str], input_data: bytes | Path, tmp_dir: Path
+) -> dict[str, float]:
+    """Run `cmd` once under perf stat (or time -l on macOS) and return its counters.
+
+    Returns {} when the counter tool is missing or its run fails.
+    """
+    if sys.platform == "darwin":
+        time_bin = _time_bin()
+        if time_bin is None:
+            return {}
+        with _stdin(input_data) as stdin:
+            res = subprocess.run(time_bin + cmd, **stdin, capture_output=True)
+        if res.returncode != 0:
+            return _counter_run_failed("time -l", cmd, res.stderr)
+        return _derive_counter_ratios(_parse_darwin_time_counters(res.stderr))
+
+    if shutil.which("perf") is None:
+        return {}
+    # perf's own report goes to a file so it cannot mix with the program's
+    # stderr; one file per run, since --jobs rows share tmp_dir.
+    fd, name = tempfile.mkstemp(prefix="perf_stat_", suffix=".csv", dir=tmp_dir)
+    os.close(fd)
+    report = Path(name)
+    try:
+        with _stdin(input_data) as stdin:
+            res = subprocess.run(
+                ["perf", "stat", "-x,", "-o", str(report), "-e", ",".join(PERF_EVENTS), "--"] + cmd,
+                **stdin,
+                capture_output=True,
+            )
+        if res.returncode != 0:
+            return _counter_run_failed("perf stat", cmd, res.stderr)
+        txt = report.read_text(errors="replace")
+    finally:
+        report.unlink(missing_ok=True)
+    return _derive_counter_ratios(_parse_perf_stat_csv(txt))
+
+
+# Shared by --jobs workers: the X07 regex project selects its entry point by
+# rewriting projects/regex/x07.json.
+_X07_PROJECT_LOCK = threading.Lock()
+
+
+def _read_sysfs(path: str) -> str:
+    try:
+        return Path(path).read_text().strip()
+    except OSError:
+        return ""
+
+
+def _parse_cpu_list(text: str) -> list[int]:
+    """Parse a kernel CPU list such as "0-3,8,10-11"."""
+    cpus: list[int] = []
+    for part in text.split(","):
+        part = part.strip()
+        if not part:
+            continue
+        lo, _, hi = part.partition("-")
+        cpus.extend(range(int(lo), int(hi or lo) + 1))
+    return cpus
+
+
+def _format_cpu_list(cpus: list[int]) -> str:
+    """The inverse of _parse_cpu_list: sorted CPUs as "0-3,8,10-11"."""
+    parts: list[str] = []
+    for cpu in sorted(cpus):
+        if parts and cpu == int(parts[-1].rpartition("-")[2]) + 1:
+            parts[-1] = f"{parts[-1].partition('-')[0]}-{cpu}"
+        else:
+            parts.append(str(cpu))
+    return ",".join(parts)
+
+
+def pinnable_cores() -> list[int]:
+    """Cores to pin measured processes to, at most one per physical core.
+
+    Prefers the kernel's isolated CPUs (isolcpus=) when there are any;
+    otherwise the CPUs this process may run on, minus CPU 0, which fields
+    most interrupts. SMT siblings of a chosen core are skipped so two jobs
+    never share a physical core. Empty where affinity is unsupported (macOS).
+    """
+    if not hasattr(os, "sched_getaffinity"):
+        return []
+    allowed = sorted(os.sched_getaffinity(0))
+    isolated = _parse_cpu_list(_read_sysfs("/sys/devices/system/cpu/isolated"))
+    candidates = isolated or [c for c in allowed if c != 0] or allowed
+
+    chosen: list[int] = []
+    taken: set[int] = set()
+    for cpu in candidates:
+        if cpu in taken:
+            continue
+        siblings = _parse_cpu_list(
+            _read_sysfs(f"/sys/devices/system/cpu/cpu{cpu}/topology/thread_siblings_list")
+        )
+        chosen.append(cpu)
+        taken.update(siblings or [cpu])
+    return chosen
+
+
+def cpu_governor(cpu: int) -> str:
+    """The cpufreq scaling governor of `cpu`, or "" where it is not exposed."""
+    return _read_sysfs(f"/sys/devices/system/cpu/cpu{cpu}/cpufreq/scaling_governor")
+
+
+@contextlib.contextmanager
+def _pinned(core: int | None):
+    """Pin the calling thread to `core` for the duration of the block.
+
+    On Linux affinity is per thread and inherited by child processes, so
+    everything spawned inside the block runs on that core only.
+    """
+    if core is None or not hasattr(os, "sched_setaffinity"):
+        yield
+        return
+    previous = os.sched_getaffinity(0)
+    os.sched_setaffinity(0, {core})
+    try:
+        yield
+    finally:
+        os.sched_setaffinity(0, previous)
+
+
+# Modified z-score (|x - median| / (1.4826 * MAD)) past which a timed run is
+# treated as an outlier; 3.5 is the usual Iglewicz-Hoaglin cut-off.
+OUTLIER_Z = 3.5
+
+# Two-sided significance level for the X07-vs-other comparisons.
+SIGNIFICANCE_ALPHA = 0.05
+
+
+def reject_outliers(samples: list[float]) -> list[float]:
+    """Samples with a modified z-score within OUTLIER_Z (all of them if MAD is 0)."""
+    if len(samples) < 3:
+        return list(samples)
+    med = statistics.median(samples)
+    mad = statistics.median(abs(x - med) for x in samples)
+    if mad == 0:
+        return list(samples)
+    return [x for x in samples if abs(x - med) / (1.4826 * mad) <= OUTLIER_Z]
+
+
+def bootstrap_ci(
+    samples: list[float], level: float = 0.95, resamples: int = 1000, seed: int = 0
+) -> tuple[float, float]:
+    """Percentile bootstrap confidence interval for the median.
+
+    Seeded, so the same samples always give the same interval.
+    """
+    if len(samples) < 2:
+        v = samples[0] if samples else 0.0
+        return v, v
+    rng = random.Random(seed)
+    medians = sorted(
+        statistics.median(rng.choices(samples, k=len(samples))) for _ in range(resamples)
+    )
+    tail = (1 - level) / 2
+    lo = medians[int(tail * (resamples - 1))]
+    hi = medians[int(math.ceil((1 - tail) * (resamples - 1)))]
+    return lo, hi
+
+
+def median_rank_ci(sorted_samples: list[float], level: float = 0.95) -> tuple[float, float] | None:
+    """Distribution-free CI for the median from order statistics.
+
+    Cheap enough to evaluate after every run, so the adaptive sampler uses it
+    as its stopping rule. None below 6 samples, where no such interval reaches
+    95% coverage.
+    """
+    n = len(sorted_samples)
+    tail = (1 - level) / 2
+    k = 0
+    cum = 0.0
+    while k < n:
+        p = math.comb(n, k) / 2**n
+        if cum + p > tail:
+            break
+        cum += p
+        k += 1
+    if k == 0:
+        return None
+    return sorted_samples[k - 1], sorted_samples[n - k]
+
+
+@functools.lru_cache(maxsize=None)
+def _u_counts(m: int, n: int) -> tuple[int, ...]:
+    """Orderings of m x's and n y's that give each Mann-Whitney U (pairs with x > y)."""
+    if m == 0 or n == 0:
+        return (1,)
+    counts = [0] * (m * n + 1)
+    for u, c in enumerate(_u_counts(m - 1, n)):  # the largest value is an x
+        counts[u + n] += c
+    for u, c in enumerate(_u_counts(m, n - 1)):  # the largest value is a y
+        counts[u] += c
+    return tuple(counts)
+
+
+def mann_whitney_p(a: list[float], b: list[float]) -> float:
+    """Two-sided Mann-Whitney U test p-value for `a` and `b` differing in location.
+
+    Exact for small tie-free samples; otherwise the normal approximation with
+    tie and continuity corrections.
+    """
+    m, n = len(a), len(b)
+    if not m or not n:
+        return 1.0
+    pooled = sorted([(v, 0) for v in a] + [(v, 1) for v in b])
+    ranks = [0.0] * len(pooled)
+    tie_term = 0.0
+    i = 0
+    while i < len(pooled):
+        j = i
+        while j + 1 < len(pooled) and pooled[j + 1][0] == pooled[i][0]:
+            j += 1
+        for k in range(i, j + 1):
+            ranks[k] = (i + j) / 2 + 1
+        t = j - i + 1
+        tie_term += t**3 - t
+        i = j + 1
+    rank_sum = sum(r for r, (_, side) in zip(ranks, pooled) if side == 0)
+    u = rank_sum - m * (m + 1) / 2
+
+    if tie_term == 0 and m + n <= 40:
+        counts = _u_counts(m, n)
+        total = sum(counts)
+        below = sum(counts[: int(u) + 1]) / total
+        above = sum(counts[int(u):]) / total
+        return min(1.0, 2 * min(below, above))
+
+    mean_u = m * n / 2
+    var_u = m * n / 12 * ((m + n + 1) - tie_term / ((m + n) * (m + n - 1)))
+    if var_u <= 0:
+        return 1.0
+    z = (abs(u - mean_u) - 0.5) / math.sqrt(var_u)
+    return min(1.0, math.erfc(max(z, 0.0) / math.sqrt(2)))
+
+
 @dataclass
 class BenchmarkResult:
     """Results from running a benchmark."""
     language: str
     benchmark: str
     times_ms: list[float] = field(default_factory=list)
-    peak_rss_kb: int = 0
+    # None: not measured (see _run_with_optional_rss).
+    peak_rss_kb: int | None = 0
     build_size_bytes: int = 0
     output_bytes: bytes = b""
     compile_time_ms: float = 0.0
+    # compile_time_ms was replayed from the build cache, not measured in this run.
+    compile_cached: bool = False
+    threads: int = 0
+    input_bytes: int = 0
+    # What the throughput columns count (see _processed_bytes).
+    processed_bytes: int = 0
+    counters: dict[str, float] = field(default_factory=dict)
+    # --kernel-timing: in-process kernel times reported by the program, or
+    # (X07, which cannot read a clock) wall times of empty-input runs.
+    kernel_times_ms: list[float] = field(default_factory=list)
+    startup_times_ms: list[float] = field(default_factory=list)
+    # --serve: per-request latency stats from one long-lived process.
+    serve: dict[str, float] = field(default_factory=dict)
+    # CPU the measured runs were pinned to (None = unpinned) and its governor.
+    core: int | None = None
+    cpu_governor: str = ""
+    # Compiler flags of the build that produced this row's binary.
+    build_flags: list[str] = field(default_factory=list)
+    # --alloc-count: malloc/free/realloc counts from tools/alloc_count.c.
+    allocations: dict[str, int] = field(default_factory=dict)
+    # X07 through x07-host-runner: the numeric report fields of each timed
+    # run (see _report_numbers), and runs of the same artifact without it,
+    # one after each host run.
+    host_reports: list[dict[str, float]] = field(default_factory=list)
+    direct_times_ms: list[float] = field(default_factory=list)
+    # --memory: faults and peaks of each timed run (see _run_memory_sampled),
+    # and the last run's [ms, VmRSS, RssAnon, RssFile] timeline in KiB.
+    memory_runs: list[dict[str, Any]] = field(default_factory=list)
+    rss_timeline_kb: list[list[float]] = field(default_factory=list)
+    # --launcher native: the rusage of each timed run (see _launch_batch).
+    launch_rusage: list[dict[str, int]] = field(default_factory=list)
     success: bool = True
     error: str = ""
 
@@ -187,6 +763,60 @@ class BenchmarkResult:
     def min_time_ms(self) -> float:
         return min(self.times_ms) if self.times_ms else 0.0
 
+    @property
+    def clean_times_ms(self) -> list[float]:
+        """Timed runs minus outliers; the median, CI and significance tests use these."""
+        return reject_outliers(self.times_ms)
+
+    @property
+    def outliers(self) -> int:
+        return len(self.times_ms) - len(self.clean_times_ms)
+
+    @property
+    def median_time_ms(self) -> float:
+        clean = self.clean_times_ms
+        return statistics.median(clean) if clean else 0.0
+
+    @property
+    def ci95_ms(self) -> tuple[float, float]:
+        """Bootstrap 95% confidence interval of the median run time."""
+        return bootstrap_ci(self.clean_times_ms)
+
+    def p_value_vs(self, other: BenchmarkResult) -> float:
+        """Mann-Whitney p-value for this row's run times differing from `other`'s."""
+        return mann_whitney_p(self.clean_times_ms, other.clean_times_ms)
+
+    @property
+    def throughput_mb_s(self) -> float:
+        """Bytes processed per second of mean run time, in MB/s."""
+        if not self.processed_bytes or self.mean_time_ms <= 0:
+            return 0.0
+        return self.processed_bytes / (self.mean_time_ms / 1000) / 1e6
+
+    @property
+    def kernel_time_ms(self) -> float:
+        """Mean time spent in the kernel alone (0.0 without --kernel-timing data)."""
+        if self.kernel_times_ms:
+            return statistics.mean(self.kernel_times_ms)
+        if self.startup_times_ms:
+            return max(self.mean_time_ms - statistics.mean(self.startup_times_ms), 0.0)
+        return 0.0
+
+    @property
+    def startup_time_ms(self) -> float:
+        """Mean wall time outside the kernel: exec, runtime init, input and output."""
+        if self.startup_times_ms:
+            return statistics.mean(self.startup_times_ms)
+        if self.kernel_times_ms:
+            return max(self.mean_time_ms - self.kernel_time_ms, 0.0)
+        return 0.0
+
+    @property
+    def kernel_throughput_mb_s(self) -> float:
+        if not self.processed_bytes or self.kernel_time_ms <= 0:
+            return 0.0
+        return self.processed_bytes / (self.kernel_time_ms / 1000) / 1e6
+
 
 @dataclass
 class InputData:
@@ -194,61 +824,785 @@ class InputData:
     name: str
     data: bytes
     size_kb: float
+    # Files written by InputCache (None = pipe `data` in): the raw input, and
+    # the same bytes after a u32 LE length for direct X07 binaries.
+    path: Path | None = None
+    framed_path: Path | None = None
+
+    @property
+    def stdin(self) -> bytes | Path:
+        """What a native program reads: the cached file, or the bytes."""
+        return self.path or self.data
+
+    @property
+    def x07_stdin(self) -> bytes | Path:
+        """What a direct X07 runner gets: the framed file, or bytes it frames."""
+        return self.framed_path or self.data
 
 
-def generate_input_data(benchmark: str, size_kb: int, seed: int = 42) -> InputData:
-    """Generate input data for a specific benchmark."""
-    random.seed(seed)
+@dataclass
+class MeasureOptions:
+    """How each compiled program is measured; shared by every language."""
+    warmup: int = 1
+    iterations: int = 5
+    # One extra run under perf stat / time -l per row (see _run_with_counters).
+    counters: bool = False
+    # Ask the programs for their in-process kernel time (see _run_kernel_timed).
+    kernel_timing: bool = False
+    # Timed requests sent to each program in server mode (0 = off; see _measure_serve).
+    serve_requests: int = 0
+    # Sample faults and RSS during the timed runs (see _run_memory_sampled).
+    memory: bool = False
+    # The built tools/launcher.c that times warmup and timed runs in one
+    # batch (None = time each run from Python; see _launch_batch).
+    launcher: Path | None = None
+    # Adaptive sampling (see _sample_times): keep running past `iterations`
+    # until the median's 95% CI is within +/- target_ci of it (0 = off), the
+    # row has used time_budget_s, or max_iterations runs are in.
+    target_ci: float = 0.0
+    time_budget_s: float = 10.0
+    max_iterations: int = 200
+    # Core the measured runs are pinned to; compiles stay unpinned (see _pinned).
+    core: int | None = None
+    # Where compiled binaries are reused from across runs (None = always build).
+    build_cache: BuildCache | None = None
+
+
+# Regex workloads, selected as `regex_<op>:<case>`. Each case pairs a
+# pattern with the text generator it is meant to stress.
+REGEX_PATTERNS: dict[str, dict[str, str]] = {
+    # The historical pattern and corpus, kept for continuity with old snapshots.
+    "class": {"pattern": "[a-z]+", "text": "letters"},
+    "literal": {"pattern": "ERROR", "text": "log"},
+    "alternation": {"pattern": "ERROR|WARN|FATAL", "text": "log"},
+    # Dates at the start of a line. The engines anchor `^` only at the start
+    # of the whole text and POSIX ERE has no multiline mode, so the line
+    # start is a literal newline (the first line is not counted).
+    "anchored": {"pattern": "\n[0-9]{4}-[0-9]{2}-[0-9]{2}", "text": "log"},
+    "fields": {"pattern": "latency_ms=[0-9]+", "text": "log"},
+    # Multi-byte literals work on every engine; \p{L} needs a Unicode-aware
+    # one (see POSIX_REGEX_UNSUPPORTED).
+    "unicode_literal": {"pattern": "Zürich|São Paulo|Kraków|東京", "text": "log"},
+    "unicode_class": {"pattern": "\\p{L}+", "text": "log"},
+    # Nested quantifier over short runs of 'a' with no 'b': exponential for
+    # backtracking engines, linear for automata.
+    "backtrack": {"pattern": "(a+)+b", "text": "a_runs"},
+}
+
+# Cases POSIX regex cannot express (it reads \p{L} as a literal). The C
+# rows built on it (C, C-io, C-zc and their variants) are not run for
+# these, so a wrong POSIX result is neither reported as a mismatch nor
+# taken as the reference the other engines are checked against.
+POSIX_REGEX_UNSUPPORTED = {"unicode_class"}
+
+
+def _posix_regex_unsupported(benchmark: str) -> bool:
+    base, case = _split_benchmark(benchmark)
+    return base.startswith("regex_") and case in POSIX_REGEX_UNSUPPORTED
+
+
+# Byte distributions for byte_freq and byte_freq_wide. Uniform bytes
+# spread the increments over all 256 counters; the others concentrate them
+# on a few, so each increment waits on the previous store to the same one.
+BYTE_FREQ_CASES = [
+    "uniform",
+    # Zipf-like: a handful of byte values cover most of the input.
+    "skewed",
+    # Runs of 1..50 equal bytes, like the rle_encode input.
+    "runs",
+    # One byte value throughout: a single dependency chain.
+    "single",
+]
+
+# Longest run of equal bytes in the rle_encode / rle_decode inputs. Short
+# runs make every run boundary a data-dependent branch; most long runs pass
+# the 255 cap, so the pairs are mostly (255, byte).
+RLE_MAX_RUN: dict[str, int] = {"short": 50, "long": 4096}
+
+# Benchmarks that are run once per case when named without one. Plain
+# byte_freq, rle_encode and word_count keep their original input and result key, for
+# continuity with old snapshots; name a case (`byte_freq:runs`) to run others.
+BENCHMARK_CASES: dict[str, list[str]] = {
+    "regex_is_match": list(REGEX_PATTERNS),
+    "regex_count": list(REGEX_PATTERNS),
+    "regex_replace": list(REGEX_PATTERNS),
+    "byte_freq_wide": BYTE_FREQ_CASES,
+    "rle_decode": list(RLE_MAX_RUN),
+    "word_count_utf8": ["vocab", "adversarial", "unicode"],
+    "word_freq": ["vocab", "highcard"],
+}
+
+
+# fib_big's n when no `fib_big:N` case names one. The multiply is O(n^2),
+# so n does not follow --size: at --size 40000 that would be F(41M), several
+# minutes per C run and hours for X07.
+FIB_BIG_N = 102400
+
+
+def _fib_big_n(case: str) -> int:
+    """The n of a `fib_big` or `fib_big:N` entry."""
+    if not case:
+        return FIB_BIG_N
+    # F(n) has about 0.69 n bits; the X07 program needs n below 2^31.
+    if not case.isdigit() or not 0 < int(case) < 2**31:
+        raise ValueError(f"fib_big case must be an n between 1 and 2^31 - 1, not {case!r}")
+    return int(case)
+
+
+def _processed_bytes(benchmark: str, data: bytes) -> int:
+    """Bytes a run of `benchmark` processes, as counted by the MB/s columns.
+
+    That is the input, except for rle_decode: its input is the compressed
+    (count, byte) pairs, so it is counted by the bytes it decodes to.
+    """
+    if _split_benchmark(benchmark)[0] == "rle_decode":
+        return sum(data[0::2])
+    return len(data)
+
+
+def _split_benchmark(benchmark: str) -> tuple[str, str]:
+    """Split `name:case` into the program name and the workload case ("" if none)."""
+    base, _, case = benchmark.partition(":")
+    return base, case
+
+
+def _expand_benchmarks(benchmarks: list[str], cases: dict[str, list[str]]) -> list[str]:
+    """Expand case-less names of multi-case benchmarks into one entry per case."""
+    expanded = []
+    for benchmark in benchmarks:
+        base, case = _split_benchmark(benchmark)
+        if not case and base in cases:
+            expanded.extend(f"{base}:{c}" for c in cases[base])
+        else:
+            expanded.append(benchmark)
+    return expanded
+
+
+_LOG_LEVELS = ["INFO"] * 80 + ["DEBUG"] * 10 + ["WARN"] * 7 + ["ERROR"] * 2 + ["FATAL"]
+_LOG_SERVICES = ["api", "auth", "billing", "search", "worker", "gateway", "scheduler"]
+_LOG_PATHS = ["/v1/users", "/v1/orders", "/v1/search", "/healthz", "/v2/items", "/login"]
+_LOG_CITIES = ["Berlin", "Zürich", "São Paulo", "Kraków", "東京", "Lisbon", "Austin", "Montréal"]
+_LOG_MESSAGES = [
+    "request completed", "cache miss", "retrying upstream call", "connection reset by peer",
+    "slow query detected", "token refreshed", "payload rejected", "queue drained",
+]
+
+
+_LETTERS = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ "
+_A_RUN_SEPARATORS = [b" ", b"c", b"\n", b"x "]
+
+
+def _log_line(rng: random.Random, ts: int) -> bytes:
+    return (
+        f"{time.strftime('%Y-%m-%dT%H:%M:%S', time.gmtime(ts))}.{rng.randint(0, 999):03d}Z "
+        f"{rng.choice(_LOG_LEVELS)} [{rng.choice(_LOG_SERVICES)}-{rng.randint(1, 16)}] "
+        f"{rng.choice(_LOG_MESSAGES)} path={rng.choice(_LOG_PATHS)} "
+        f"status={rng.choice([200, 200, 200, 201, 204, 404, 500, 503])} "
+        f"latency_ms={int(rng.expovariate(1 / 40))} city={rng.choice(_LOG_CITIES)} "
+        f"req={rng.getrandbits(48):012x}\n"
+    ).encode()
+
+
+def _utf8_prefix(text: bytes, size: int) -> bytes:
+    """Cut on a character boundary so Unicode-aware engines see valid UTF-8."""
+    return text[:size].decode("utf-8", errors="ignore").encode()
+
+
+def _generate_regex_text(rng: random.Random, kind: str, size: int) -> bytes:
+    """Generate `size` bytes of valid UTF-8 regex subject text of the given kind."""
+    if kind == "letters":
+        return "".join(rng.choices(_LETTERS, k=size)).encode()
+
+    out = bytearray()
+    if kind == "a_runs":
+        while len(out) < size:
+            out.extend(b"a" * rng.randint(1, 12))
+            out.extend(rng.choice(_A_RUN_SEPARATORS))
+    elif kind == "log":
+        ts = 1_773_700_000
+        while len(out) < size:
+            ts += rng.randint(0, 3)
+            out.extend(_log_line(rng, ts))
+    else:
+        raise ValueError(f"unknown regex text kind: {kind}")
+
+    return _utf8_prefix(bytes(out), size)
+
+
+# Inputs at least this large default to the fast generators (--generator auto).
+# Smaller ones keep the exact generators, so their bytes, and the snapshots
+# measured on them, do not change.
+FAST_GENERATOR_MIN_KB = 64 * 1024
+
+# Lines or words sampled from by the fast text generators; large enough
+# that a token repeats only every few thousand tokens on average.
+_FAST_POOL = 8192
+
+
+def resolve_generator(generator: str, size_kb: int) -> str:
+    """Map --generator auto to exact or fast for an input of size_kb."""
+    if generator == "auto":
+        return "fast" if size_kb >= FAST_GENERATOR_MIN_KB else "exact"
+    return generator
+
+
+def _fill(rng: random.Random, size: int, tokens: list[bytes]) -> bytes:
+    """Uniformly chosen `tokens` concatenated up to exactly `size` bytes."""
+    avg = sum(map(len, tokens)) / len(tokens)
+    parts = []
+    total = 0
+    while total < size:
+        block = b"".join(rng.choices(tokens, k=int((size - total) / avg) + 1))
+        parts.append(block)
+        total += len(block)
+    return b"".join(parts)[:size]
+
+
+def _generate_regex_text_fast(rng: random.Random, kind: str, size: int) -> bytes:
+    """Same kinds of text as _generate_regex_text, built in bulk.
+
+    The letter stream maps random bytes onto the alphabet, so it is very
+    slightly biased. Log text is sampled from a pool of lines, so the
+    timestamps are not monotonic.
+    """
+    if kind == "letters":
+        table = bytes(ord(_LETTERS[b % len(_LETTERS)]) for b in range(256))
+        return rng.randbytes(size).translate(table)
+    if kind == "a_runs":
+        return _fill(rng, size, [b"a" * n + sep for n in range(1, 13) for sep in _A_RUN_SEPARATORS])
+    if kind == "log":
+        ts = 1_773_700_000
+        pool = [_log_line(rng, ts + i) for i in range(_FAST_POOL)]
+        return _utf8_prefix(_fill(rng, size, pool), size)
+    raise ValueError(f"unknown regex text kind: {kind}")
+
+
+_WORDS = ["the", "quick", "brown", "fox", "jumps", "over", "lazy", "dog",
+          "hello", "world", "python", "rust", "code", "test", "benchmark"]
+
+# Alphabets and separators of the word_count / word_count_utf8 cases after
+# "vocab" (the historical 15-word text). Words are 1..12 random characters,
+# so neither word ends nor separator kinds can be predicted.
+_ASCII_WORD_CHARS = "".join(chr(c) for c in range(33, 127))
+_ASCII_SPACES = [" ", " ", " ", "  ", "\t", "\n", "\r\n", " \t"]
+_WORD_TEXT: dict[str, tuple[str, list[str]]] = {
+    "adversarial": (_ASCII_WORD_CHARS, _ASCII_SPACES),
+    # Multi-byte letters, Unicode White_Space (NBSP, NEL, em, thin and
+    # ideographic spaces, the line separator, ...) and look-alikes that are
+    # not White_Space: U+200B and U+2030 share a lead byte with U+2000..U+200A.
+    "unicode": (
+        "abcdefghijklmnopqrstuvwxyzäöüßéñçłżжд東京大阪🙂\u200b\u2030\u00a9",
+        _ASCII_SPACES + ["\u00a0", "\u0085", "\u1680", "\u2003", "\u2009", "\u2028",
+                         "\u202f", "\u205f", "\u3000", "\v", "\f"],
+    ),
+}
+
+
+def _generate_words(rng: random.Random, size: int) -> bytes:
+    out = bytearray()
+    first = True
+    while len(out) < size:
+        if not first:
+            out.append(32)
+        out.extend(rng.choice(_WORDS).encode())
+        first = False
+        if rng.random() < 0.1:
+            if len(out) >= size:
+                break
+            out.append(32)
+            out.append(10)
+    return bytes(out[:size])
+
+
+def _word_token(rng: random.Random, case: str) -> bytes:
+    alphabet, spaces = _WORD_TEXT[case]
+    return ("".join(rng.choices(alphabet, k=rng.randint(1, 12))) + rng.choice(spaces)).encode()
+
+
+# The fast generators below draw from the same distributions as the exact
+# ones (uniform bytes, runs of equal bytes, words with a newline after ~10%
+# of them) but build whole blocks with C-level joins instead of a Python
+# loop per byte, so their bytes differ for one seed.
+
+
+def _fast_words(rng: random.Random, size: int) -> bytes:
+    # Nine plain separators to one line break gives the 10% newline rate.
+    seps = [b" "] * 9 + [b" \n "]
+    return _fill(rng, size, [w.encode() + sep for w in _WORDS for sep in seps])
+
+
+def _fast_runs(rng: random.Random, size: int, max_run: int = 50) -> bytes:
+    parts = []
+    total = 0
+    while total < size:
+        k = 2 * (size - total) // (max_run + 1) + 1
+        block = b"".join(map(
+            bytes.__mul__,
+            map(_BYTE_STRINGS.__getitem__, rng.randbytes(k)),
+            rng.choices(range(1, max_run + 1), k=k),
+        ))
+        parts.append(block)
+        total += len(block)
+    return b"".join(parts)[:size]
+
+
+_BYTE_STRINGS = [bytes((b,)) for b in range(256)]
+
+
+# Spells the hex digits of a rank as letters, so highcard words stay alphabetic.
+_HEX_AS_LETTERS = str.maketrans("0123456789", "ghijklmnop")
+
+
+def _generate_highcard(rng: random.Random, size: int) -> bytes:
+    """Words from a vocabulary that grows with size, with log-uniform ranks.
+
+    A few words still repeat often enough for a meaningful top-k, but most
+    of the vocabulary occurs once or twice, so a word-frequency table ends
+    up with tens of thousands of entries instead of 15. It already builds
+    whole blocks, so it serves both --generator modes.
+    """
+    vocab = max(1024, size // 16)
+    words = [f"{i:x}" for i in range(vocab)]
+    parts = []
+    total = 0
+    while total < size:
+        k = (size - total) // 4 + 12
+        picks = [words[int(vocab ** rng.random()) - 1] for _ in range(k)]
+        block = "\n".join(" ".join(picks[j:j + 12]) for j in range(0, k, 12)) + "\n"
+        parts.append(block)
+        total += len(block)
+    return "".join(parts).translate(_HEX_AS_LETTERS).encode()[:size]
+
+
+def _generate_word_text(rng: random.Random, case: str, size: int, fast: bool) -> bytes:
+    if case == "vocab":
+        return _fast_words(rng, size) if fast else _generate_words(rng, size)
+    if case == "highcard":
+        return _generate_highcard(rng, size)
+    if case not in _WORD_TEXT:
+        raise ValueError(f"unknown word_count case: {case}")
+    if fast:
+        pool = [_word_token(rng, case) for _ in range(_FAST_POOL)]
+        return _utf8_prefix(_fill(rng, size, pool), size)
+    out = bytearray()
+    while len(out) < size:
+        out.extend(_word_token(rng, case))
+    return _utf8_prefix(bytes(out), size)
+
+
+def _generate_runs(rng: random.Random, size: int, max_run: int = 50) -> bytes:
+    data_list = []
+    while len(data_list) < size:
+        byte_val = rng.randint(0, 255)
+        run_len = rng.randint(1, min(max_run, size - len(data_list)))
+        data_list.extend([byte_val] * run_len)
+    return bytes(data_list[:size])
+
+
+def _rle_encode(data: bytes) -> bytes:
+    """(cnt, byte) pairs with runs split at 255, the format of rle_encode's output."""
+    out = bytearray()
+    for m in re.finditer(rb"(.)\1*", data, re.DOTALL):
+        n, b = m.end() - m.start(), data[m.start()]
+        full, rest = divmod(n, 255)
+        out += bytes((255, b)) * full
+        if rest:
+            out += bytes((rest, b))
+    return bytes(out)
+
+
+def _zipf_table(rng: random.Random, s: float = 1.1) -> bytes:
+    """A bytes.translate table mapping uniform bytes onto Zipf(s) byte values.
+
+    Entry i is the value at CDF quantile (i + 0.5) / 256, and ranks are
+    assigned to byte values in a seeded random order, so the common values
+    are not simply the low ones.
+    """
+    values = list(range(256))
+    rng.shuffle(values)
+    weights = [1 / (rank + 1) ** s for rank in range(256)]
+    total = sum(weights)
+    table = bytearray()
+    rank, cdf = 0, weights[0] / total
+    for i in range(256):
+        while (i + 0.5) / 256 > cdf:
+            rank += 1
+            cdf += weights[rank] / total
+        table.append(values[rank])
+    return bytes(table)
+
+
+def _generate_byte_freq(rng: random.Random, case: str, size: int, fast: bool) -> bytes:
+    if case == "uniform":
+        return rng.randbytes(size) if fast else bytes(rng.randint(0, 255) for _ in range(size))
+    if case == "skewed":
+        table = _zipf_table(rng)
+        return rng.randbytes(size).translate(table)
+    if case == "runs":
+        return _fast_runs(rng, size) if fast else _generate_runs(rng, size)
+    if case == "single":
+        return bytes([rng.randint(0, 255)]) * size
+    raise ValueError(f"unknown byte_freq case: {case}")
+
+
+def generate_input_data(
+    benchmark: str, size_kb: int, seed: int = 42, generator: str = "exact"
+) -> InputData:
+    """Generate input data for a specific benchmark.
+
+    `benchmark` may carry a case suffix (`regex_count:literal`) that selects
+    the workload variant; see _split_benchmark. `generator` is exact, fast
+    or auto (see resolve_generator).
+    """
+    name = benchmark
+    benchmark, case = _split_benchmark(benchmark)
+    # A private generator keeps inputs deterministic when --jobs runs
+    # several generators at once; Random(seed) matches random.seed(seed).
+    rng = random.Random(seed)
     size = size_kb * 1024
+    fast = resolve_generator(generator, size_kb) == "fast"
+    regex_text = _generate_regex_text_fast if fast else _generate_regex_text
 
     if benchmark == "sum_bytes":
-        data = bytes(random.randint(0, 255) for _ in range(size))
-    elif benchmark == "word_count":
-        words = ["the", "quick", "brown", "fox", "jumps", "over", "lazy", "dog",
-                 "hello", "world", "python", "rust", "code", "test", "benchmark"]
-        out = bytearray()
-        first = True
-        while len(out) < size:
-            if not first:
-                out.append(32)
-            out.extend(random.choice(words).encode())
-            first = False
-            if random.random() < 0.1:
-                if len(out) >= size:
-                    break
-                out.append(32)
-                out.append(10)
-        data = bytes(out[:size])
-    elif benchmark == "rle_encode":
-        data_list = []
-        while len(data_list) < size:
-            byte_val = random.randint(0, 255)
-            run_len = random.randint(1, min(50, size - len(data_list)))
-            data_list.extend([byte_val] * run_len)
-        data = bytes(data_list[:size])
-    elif benchmark == "byte_freq":
-        data = bytes(random.randint(0, 255) for _ in range(size))
+        data = rng.randbytes(size) if fast else bytes(rng.randint(0, 255) for _ in range(size))
+    elif benchmark in ("word_count", "word_count_utf8", "word_freq"):
+        data = _generate_word_text(rng, case or "vocab", size, fast)
+    elif benchmark in ("rle_encode", "rle_decode"):
+        max_run = RLE_MAX_RUN[case or "short"]
+        raw = _fast_runs(rng, size, max_run) if fast else _generate_runs(rng, size, max_run)
+        # The decoder gets the encoder's output, so it writes `size` bytes.
+        data = _rle_encode(raw) if benchmark == "rle_decode" else raw
+    elif benchmark in ("byte_freq", "byte_freq_wide"):
+        data = _generate_byte_freq(rng, case or "uniform", size, fast)
     elif benchmark == "fibonacci":
         n = min(46, size_kb * 10)
         data = struct.pack("<I", n)
+    elif benchmark == "fib_big":
+        data = struct.pack("<I", _fib_big_n(case))
     elif benchmark == "regex_is_match" or benchmark == "regex_count":
         # Input format: 4 bytes (pat_len) + pattern + text
-        pattern = b"[a-z]+"
-        text_size = max(1, size - 4 - len(pattern))
-        text = "".join(random.choices("abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ ", k=text_size)).encode()
+        spec = REGEX_PATTERNS[case or "class"]
+        pattern = spec["pattern"].encode()
+        text = regex_text(rng, spec["text"], max(1, size - 4 - len(pattern)))
         data = struct.pack("<I", len(pattern)) + pattern + text
-    elif benchmark == "regex_replace":
+    elif benchmark in ("regex_replace", "pipeline"):
         # Input format: 4 bytes (pat_len) + 4 bytes (repl_len) + pattern + replacement + text
-        pattern = b"[a-z]+"
+        # The pipeline defaults to redacting a field of log lines.
+        spec = REGEX_PATTERNS[case or ("fields" if benchmark == "pipeline" else "class")]
+        pattern = spec["pattern"].encode()
         replacement = b"X"
         header_size = 4 + 4 + len(pattern) + len(replacement)
-        text_size = max(1, size - header_size)
-        text = "".join(random.choices("abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ ", k=text_size)).encode()
+        text = regex_text(rng, spec["text"], max(1, size - header_size))
         data = struct.pack("<I", len(pattern)) + struct.pack("<I", len(replacement)) + pattern + replacement + text
+    elif fast:
+        data = rng.randbytes(size)
     else:
-        data = bytes(random.randint(0, 255) for _ in range(size))
+        data = bytes(rng.randint(0, 255) for _ in range(size))
+
+    return InputData(name=f"{name}_{size_kb}kb", data=data, size_kb=len(data) / 1024)
+
+
+# Bump when a generator's output changes, so cached input files are rebuilt.
+INPUT_CACHE_VERSION = 2
+
+
+def _default_input_cache_dir() -> Path:
+    env = os.environ.get("X07_PERF_INPUT_CACHE")
+    if env:
+        return Path(env).expanduser()
+    xdg = os.environ.get("XDG_CACHE_HOME")
+    base = Path(xdg).expanduser() if xdg else Path.home() / ".cache"
+    return base / "x07-perf-compare" / "inputs"
+
+
+def _write_atomically(path: Path, chunks: list[bytes]) -> None:
+    """Write `path` so a concurrent job never reads a partial file."""
+    path.parent.mkdir(parents=True, exist_ok=True)
+    staging = path.with_name(f"{path.name}.{os.getpid()}.{threading.get_ident()}.tmp")
+    with open(staging, "wb") as f:
+        for chunk in chunks:
+            f.write(chunk)
+    os.replace(staging, path)
+
+
+class InputCache:
+    """Generated inputs kept as files, keyed by benchmark, size, seed and generator.
+
+    Programs get the file itself as stdin, so they can fstat and mmap it
+    (the C-io rows do) and piping through the runner drops out of the
+    measured time. Each input is stored twice: raw, and framed for direct
+    X07 binaries.
+    """
+
+    def __init__(self, root: Path):
+        self.root = root
+        self.hits = 0
+        self.builds = 0
+        self._lock = threading.Lock()
+
+    def get(self, benchmark: str, size_kb: int, seed: int, generator: str) -> InputData:
+        generator = resolve_generator(generator, size_kb)
+        stem = "_".join([
+            benchmark.replace(":", "-"), f"{size_kb}k", f"s{seed}", generator,
+            f"v{INPUT_CACHE_VERSION}",
+        ])
+        raw = self.root / f"{stem}.bin"
+        framed = self.root / f"{stem}.x07"
+        if raw.exists() and framed.exists():
+            data = raw.read_bytes()
+            inp = InputData(name=f"{benchmark}_{size_kb}kb", data=data, size_kb=len(data) / 1024)
+            with self._lock:
+                self.hits += 1
+        else:
+            inp = generate_input_data(benchmark, size_kb, seed, generator)
+            _write_atomically(raw, [inp.data])
+            _write_atomically(framed, [struct.pack("<I", len(inp.data)), inp.data])
+            with self._lock:
+                self.builds += 1
+        return replace(inp, path=raw, framed_path=framed)
+
+
+# Benchmarks whose input does not grow with --size; --sweep skips them.
+SWEEP_FIXED_INPUT = {"fibonacci", "fib_big"}
+
+_SIZE_UNITS_KB = {"K": 1, "M": 1024, "G": 1024 * 1024}
+
+
+def _parse_size_kb(text: str) -> int:
+    """Parse a size such as 4K, 16M or 1G (binary units) into KiB."""
+    text = text.strip().upper().removesuffix("B").removesuffix("I")
+    unit = text[-1:] if text[-1:] in _SIZE_UNITS_KB else "K"
+    number = text[:-1] if text[-1:] in _SIZE_UNITS_KB else text
+    value = int(number) * _SIZE_UNITS_KB[unit]
+    if value < 1:
+        raise ValueError(f"size must be at least 1K: {text}")
+    return value
+
+
+def _format_size_kb(size_kb: int) -> str:
+    for unit in ("G", "M"):
+        if size_kb % _SIZE_UNITS_KB[unit] == 0:
+            return f"{size_kb // _SIZE_UNITS_KB[unit]}{unit}"
+    return f"{size_kb}K"
+
+
+def _sweep_sizes_kb(spec: str, step: int) -> list[int]:
+    """Geometric sizes for `--sweep LO..HI`, multiplying by `step`; HI is always included."""
+    lo_text, sep, hi_text = spec.partition("..")
+    if not sep:
+        raise ValueError(f"--sweep expects LO..HI (e.g. 4K..1G): {spec}")
+    lo, hi = _parse_size_kb(lo_text), _parse_size_kb(hi_text)
+    if hi < lo:
+        raise ValueError(f"--sweep upper bound is below the lower bound: {spec}")
+    if step < 2:
+        raise ValueError("--sweep-step must be >= 2")
+    sizes = [lo]
+    while sizes[-1] * step <= hi:
+        sizes.append(sizes[-1] * step)
+    if sizes[-1] != hi:
+        sizes.append(hi)
+    return sizes
+
+
+def _default_build_cache_dir() -> Path:
+    env = os.environ.get("X07_PERF_BUILD_CACHE")
+    if env:
+        return Path(env).expanduser()
+    xdg = os.environ.get("XDG_CACHE_HOME")
+    base = Path(xdg).expanduser() if xdg else Path.home() / ".cache"
+    return base / "x07-perf-compare" / "builds"
+
+
+@functools.lru_cache(maxsize=None)
+def _tool_identity(*cmd: str) -> str:
+    """Version banner of a toolchain command (e.g. `cc --version`), memoized per run."""
+    try:
+        res = subprocess.run(list(cmd), capture_output=True, text=True)
+    except OSError:
+        return f"{cmd[0]}: unavailable"
+    return (res.stdout + res.stderr).strip()
+
+
+@functools.lru_cache(maxsize=None)
+def _file_digest(path: Path) -> str:
+    """sha256 of a file that does not change during a run (e.g. x07-host-runner)."""
+    h = hashlib.sha256()
+    with open(path, "rb") as f:
+        for chunk in iter(lambda: f.read(1 << 20), b""):
+            h.update(chunk)
+    return h.hexdigest()
+
+
+@functools.lru_cache(maxsize=None)
+def _host_cpu_identity() -> str:
+    """CPU model and feature flags; builds use -march=native / target-cpu=native."""
+    ident = [platform.machine()]
+    cpuinfo = _read_sysfs("/proc/cpuinfo")
+    for line in cpuinfo.splitlines():
+        key = line.split(":", 1)[0].strip()
+        if key in ("model name", "flags", "Features", "CPU part"):
+            ident.append(line)
+            if key in ("flags", "Features"):
+                break
+    if sys.platform == "darwin":
+        ident.append(_tool_identity("sysctl", "-n", "machdep.cpu.brand_string"))
+    return "\n".join(ident)
+
+
+class BuildCache:
+    """Content-addressed store of compiled benchmark binaries.
+
+    Entries are keyed by everything that can change the binary: the bytes
+    of the sources and shared headers, the compiler's version banner, the
+    flags, and the host CPU. A hit copies the stored binary into place and
+    reports the compile time measured when it was built; `replayed` tells
+    such outputs apart from fresh builds. With `refresh`, every build runs
+    (and is timed) and its entry is replaced.
+    """
+
+    def __init__(self, root: Path, refresh: bool = False):
+        self.root = root
+        self.refresh = refresh
+        self.hits = 0
+        self.builds = 0
+        self._replayed: set[Path] = set()
+        self._lock = threading.Lock()
+
+    def key(self, parts: list[str], files: list[Path]) -> str:
+        h = hashlib.sha256()
+        for part in [_host_cpu_identity()] + parts:
+            h.update(part.encode())
+            h.update(b"\0")
+        for path in files:
+            h.update(path.name.encode())
+            h.update(b"\0")
+            h.update(path.read_bytes())
+            h.update(b"\0")
+        return h.hexdigest()
+
+    def build(
+        self, parts: list[str], files: list[Path], output: Path, build: Callable[[], float]
+    ) -> float:
+        """Produce `output` from the cache or by calling `build()`; returns compile ms."""
+        entry = self.root / self.key(parts, files)[:40]
+        meta_path = entry / "meta.json"
+        if not self.refresh and meta_path.exists():
+            try:
+                meta = json.loads(meta_path.read_text())
+                shutil.copy2(entry / "artifact", output)
+                with self._lock:
+                    self.hits += 1
+                    self._replayed.add(output)
+                return float(meta["compile_time_ms"])
+            except (OSError, ValueError, KeyError):
+                pass
+
+        compile_ms = build()
+        with self._lock:
+            self.builds += 1
+            self._replayed.discard(output)
+
+        # Stage the entry next to its final place and rename it in, so a
+        # concurrent job or an interrupted run never sees half an entry.
+        self.root.mkdir(parents=True, exist_ok=True)
+        staging = Path(tempfile.mkdtemp(prefix=".staging-", dir=self.root))
+        try:
+            shutil.copy2(output, staging / "artifact")
+            (staging / "meta.json").write_text(
+                json.dumps({"compile_time_ms": compile_ms, "parts": parts,
+                            "files": [str(f) for f in files], "created": time.time()})
+            )
+            shutil.rmtree(entry, ignore_errors=True)
+            os.replace(staging, entry)
+        except OSError:
+            shutil.rmtree(staging, ignore_errors=True)
+        return compile_ms
+
+    def replayed(self, *outputs: Path) -> bool:
+        """Whether every one of `outputs` came from a hit, so its compile time was not measured now."""
+        with self._lock:
+            return all(output in self._replayed for output in outputs)
+
+
+def _compile_replayed(opts: "MeasureOptions", *outputs: Path) -> bool:
+    return opts.build_cache is not None and opts.build_cache.replayed(*outputs)
+
+
+def _cached_compile(
+    cache: BuildCache | None,
+    parts: list[str],
+    files: list[Path],
+    output: Path,
+    build: Callable[[], float],
+) -> float:
+    if cache is None:
+        return build()
+    return cache.build(parts, files, output, build)
+
+
+_RUST_MOD_DECL = re.compile(r'^(?:#\[path = "([^"]+)"\]\s*)?mod (\w+);', re.M)
+
+
+def _rust_module_files(sources: list[Path]) -> list[Path]:
+    """Files that `mod name;` declarations in `sources` pull in, recursively.
+
+    The build cache hashes these too: the harness (rust/bench.rs) and the
+    kernels shared between programs (rust/*_kernel.rs). A declaration is
+    resolved next to the file that makes it, as rustc does for crate roots.
+    """
+    found: list[Path] = []
+    pending = list(sources)
+    while pending:
+        source = pending.pop()
+        for path, name in _RUST_MOD_DECL.findall(source.read_text()):
+            candidates = [source.parent / path] if path else [
+                source.parent / f"{name}.rs", source.parent / name / "mod.rs",
+            ]
+            module = next((c.resolve() for c in candidates if c.exists()), None)
+            if module is not None and module not in found and module not in sources:
+                found.append(module)
+                pending.append(module)
+    return found
+
+
+def _tree_files(root: Path, skip: tuple[str, ...] = ("target",)) -> list[Path]:
+    """All files under `root` in a stable order, skipping build output dirs."""
+    return sorted(
+        p for p in root.rglob("*")
+        if p.is_file() and not any(part in skip for part in p.relative_to(root).parts)
+    )
+
+
+# Build flags per toolchain. Runners record the flags of their last build in
+# `last_flags`, which _measure_native / _measure_x07 copy into the result.
+C_OPT_FLAGS = ["-O3", "-march=native"]
+C_DEBUG_FLAGS = ["-O0", "-g"]
+RUST_OPT_FLAGS = ["-C", "opt-level=3", "-C", "target-cpu=native"]
+GO_BUILD_FLAGS = ["-trimpath", "-buildvcs=false", "-ldflags", "-s -w"]
+CARGO_BUILD_FLAGS = ["--release"]
+X07_COMPILE_FLAGS = [
+    "--world", "solve-pure",
+    "--solve-fuel", "500000000",
+    "--max-memory-bytes", str(256 * 1024 * 1024),
+]
+
+
+def _c_flags(optimize: bool, opt_flags: list[str] | None = None) -> list[str]:
+    if opt_flags is not None:
+        return list(opt_flags)
+    return C_OPT_FLAGS if optimize else C_DEBUG_FLAGS
 
-    return InputData(name=f"{benchmark}_{size_kb}kb", data=data, size_kb=len(data) / 1024)
+
+def _x07_flags(cc_profile: str) -> list[str]:
+    return (["--cc-profile", cc_profile] if cc_profile != "default" else []) + X07_COMPILE_FLAGS
+
+
+def _x07_cache_parts(kind: str, host_runner: Path, cc_profile: str) -> list[str]:
+    """Build-cache key parts of an X07 build: the host runner, its flags and the C compiler it drives."""
+    cc = os.environ.get("CC", "cc")
+    return [kind, _file_digest(host_runner), f"CC={cc}", _tool_identity(cc, "--version")] + _x07_flags(
+        cc_profile
+    )
 
 
 class X07Runner:
@@ -308,12 +1662,18 @@ class X07Runner:
     def run_cached(
         self,
         artifact_path: Path,
-        input_data: bytes,
+        input_data: bytes | Path,
     ) -> tuple[bytes, dict[str, Any]]:
-        """Run a pre-compiled X07 artifact."""
-        with tempfile.NamedTemporaryFile(delete=False, suffix=".bin") as f:
-            f.write(input_data)
-            input_path = Path(f.name)
+        """Run a pre-compiled X07 artifact.
+
+        A Path is handed to `--input` as is; bytes go through a temporary file.
+        """
+        if isinstance(input_data, Path):
+            input_path = input_data
+        else:
+            with tempfile.NamedTemporaryFile(delete=False, suffix=".bin") as f:
+                f.write(input_data)
+                input_path = Path(f.name)
 
         try:
             cmd = [
@@ -346,25 +1706,38 @@ class X07Runner:
             return output_bytes, output
 
         finally:
-            input_path.unlink(missing_ok=True)
+            if input_path is not input_data:
+                input_path.unlink(missing_ok=True)
 
 
 class X07DirectRunner:
     """Runner for compiled X07 binaries (direct execution, no host runner overhead)."""
 
-    def __init__(self, host_runner: Path, cc_profile: str = "default"):
+    def __init__(
+        self, host_runner: Path, cc_profile: str = "default", cache: BuildCache | None = None
+    ):
         self.cwd = host_runner.parent
         self.cc_profile = cc_profile
         self.host_runner = host_runner
+        self.cache = cache
+        self.last_flags: list[str] = []
 
     def compile(self, program_path: Path, artifact_path: Path) -> float:
         """Compile an X07 program to a native binary, returning compile time in ms."""
+        self.last_flags = _x07_flags(self.cc_profile)
+        return _cached_compile(
+            self.cache,
+            _x07_cache_parts("x07", self.host_runner, self.cc_profile),
+            [program_path],
+            artifact_path,
+            lambda: self._compile(program_path, artifact_path),
+        )
+
+    def _compile(self, program_path: Path, artifact_path: Path) -> float:
         start = time.perf_counter()
         cmd = _x07_host_runner_prefix(self.host_runner, self.cc_profile) + [
             "--program", str(program_path),
-            "--world", "solve-pure",
-            "--solve-fuel", "500000000",  # High fuel for actual execution
-            "--max-memory-bytes", str(256 * 1024 * 1024),
+        ] + X07_COMPILE_FLAGS + [
             "--compiled-out", str(artifact_path),
             "--compile-only",
         ]
@@ -392,78 +1765,112 @@ class X07DirectRunner:
 
         return compile_time
 
-    def run_direct(self, binary_path: Path, input_data: bytes) -> tuple[bytes, float]:
+    def run_direct(self, binary_path: Path, input_data: bytes | Path) -> tuple[bytes, float]:
         """Run a compiled X07 binary directly with length-prefixed I/O.
 
         Binary ABI:
         - Input: 4 bytes (u32_le length) + data
         - Output: 4 bytes (u32_le length) + data
-        """
-        # Prepare length-prefixed input
-        input_len = len(input_data)
-        prefixed_input = struct.pack("<I", input_len) + input_data
 
-        start = time.perf_counter()
-        result = subprocess.run(
-            [str(binary_path)],
-            input=prefixed_input,
-            capture_output=True,
-        )
-        run_time = (time.perf_counter() - start) * 1000
+        Raw bytes are framed here; a Path must already be framed.
+        """
+        with _stdin(_x07_framed(input_data)) as stdin:
+            start = time.perf_counter()
+            result = subprocess.run(
+                [str(binary_path)],
+                **stdin,
+                capture_output=True,
+            )
+            run_time = (time.perf_counter() - start) * 1000
 
         if result.returncode != 0:
             raise RuntimeError(f"X07 execution failed (exit {result.returncode})")
 
-        # Parse length-prefixed output
-        raw_output = result.stdout
-        if len(raw_output) < 4:
-            raise RuntimeError(f"X07 output too short: {len(raw_output)} bytes")
+        return _x07_unframed(result.stdout), run_time
 
-        out_len = struct.unpack("<I", raw_output[:4])[0]
-        if len(raw_output) < 4 + out_len:
-            raise RuntimeError(f"X07 output truncated: expected {out_len}, got {len(raw_output) - 4}")
-
-        output_bytes = raw_output[4:4 + out_len]
-        return output_bytes, run_time
-
-    def run_direct_with_rss(self, binary_path: Path, input_data: bytes) -> tuple[bytes, int]:
+    def run_direct_with_rss(self, binary_path: Path, input_data: bytes | Path) -> tuple[bytes, int | None]:
         """Run a compiled X07 binary directly and return output plus peak RSS (KB)."""
-        input_len = len(input_data)
-        prefixed_input = struct.pack("<I", input_len) + input_data
-
         res, rss_kb = _run_with_optional_rss(
-            [str(binary_path)], prefixed_input, measure_rss=True
+            [str(binary_path)], _x07_framed(input_data), measure_rss=True
         )
         if res.returncode != 0:
             raise RuntimeError(f"X07 execution failed (exit {res.returncode})")
 
-        raw_output = res.stdout
-        if len(raw_output) < 4:
-            raise RuntimeError(f"X07 output too short: {len(raw_output)} bytes")
-
-        out_len = struct.unpack("<I", raw_output[:4])[0]
-        if len(raw_output) < 4 + out_len:
-            raise RuntimeError(
-                f"X07 output truncated: expected {out_len}, got {len(raw_output) - 4}"
-            )
-
-        output_bytes = raw_output[4 : 4 + out_len]
-        return output_bytes, rss_kb
+        return _x07_unframed(res.stdout), rss_kb
 
 
 class CRunner:
     """Runner for C programs."""
 
-    def __init__(self, cc: str = "cc"):
+    def __init__(self, cc: str = "cc", cxx: str = "c++", cache: BuildCache | None = None):
         self.cc = cc
+        self.cxx = cxx
+        self.cache = cache
+        self.last_flags: list[str] = []
+
+    def compile(
+        self,
+        source_path: Path,
+        output_path: Path,
+        optimize: bool = True,
+        extra_flags: list[str] | None = None,
+        extra_sources: list[Path] | None = None,
+        link_flags: list[str] | None = None,
+        opt_flags: list[str] | None = None,
+    ) -> float:
+        """Compile a C program, returning compile time in ms.
+
+        `extra_sources` may include C++ shims (.cc); those are compiled with
+        the C++ compiler and the final link goes through it as well.
+        `opt_flags` replaces C_OPT_FLAGS (see BUILD_VARIANTS).
+        """
+        flags = _c_flags(optimize, opt_flags) + (extra_flags or [])
+        self.last_flags = flags + (link_flags or [])
+        parts = ["c", _tool_identity(self.cc, "--version")] + flags + ["--link"] + (link_flags or [])
+        if extra_sources:
+            parts.append(_tool_identity(self.cxx, "--version"))
+        # The shared headers next to the program (bench.h, regex_engine.h).
+        files = [source_path] + list(extra_sources or []) + sorted(source_path.parent.glob("*.h"))
+        return _cached_compile(
+            self.cache,
+            parts,
+            files,
+            output_path,
+            lambda: self._compile(
+                source_path, output_path, flags, extra_sources, link_flags
+            ),
+        )
 
-    def compile(self, source_path: Path, output_path: Path, optimize: bool = True) -> float:
-        """Compile a C program, returning compile time in ms."""
-        flags = ["-O3", "-march=native"] if optimize else ["-O0", "-g"]
+    def _compile(
+        self,
+        source_path: Path,
+        output_path: Path,
+        flags: list[str],
+        extra_sources: list[Path] | None,
+        link_flags: list[str] | None,
+    ) -> float:
+        cxx_sources = [src for src in extra_sources or [] if src.suffix in (".cc", ".cpp")]
+        c_sources = [src for src in extra_sources or [] if src not in cxx_sources]
 
         start = time.perf_counter()
+        objects: list[str] = []
+        for i, src in enumerate(cxx_sources):
+            obj = output_path.parent / f"{output_path.name}.{i}.o"
+            result = subprocess.run(
+                [self.cxx] + flags + ["-std=c++17", "-c", "-o", str(obj), str(src)],
+                capture_output=True,
+                text=True,
+            )
+            if result.returncode != 0:
+                raise RuntimeError(f"C++ compilation failed: {result.stderr}")
+            objects.append(str(obj))
+
+        cmd = [self.cc] + flags + ["-o", str(output_path), str(source_path)]
+        cmd += [str(src) for src in c_sources] + objects + (link_flags or [])
+        if cxx_sources:
+            cmd.append("-lstdc++")
         result = subprocess.run(
-            [self.cc] + flags + ["-o", str(output_path), str(source_path)],
+            cmd,
             capture_output=True,
             text=True,
         )
@@ -474,24 +1881,31 @@ class CRunner:
 
         return compile_time
 
-    def run(self, binary_path: Path, input_data: bytes) -> tuple[bytes, float]:
+    def run(
+        self, binary_path: Path, input_data: bytes | Path, args: list[str] | None = None
+    ) -> tuple[bytes, float]:
         """Run a compiled C program, returning output and time in ms."""
-        start = time.perf_counter()
-        result = subprocess.run(
-            [str(binary_path)],
-            input=input_data,
-            capture_output=True,
-        )
-        run_time = (time.perf_counter() - start) * 1000
+        with _stdin(input_data) as stdin:
+            start = time.perf_counter()
+            result = subprocess.run(
+                [str(binary_path)] + (args or []),
+                **stdin,
+                capture_output=True,
+            )
+            run_time = (time.perf_counter() - start) * 1000
 
         if result.returncode != 0:
             raise RuntimeError(f"C execution failed: {result.stderr.decode()}")
 
         return result.stdout, run_time
 
-    def run_with_rss(self, binary_path: Path, input_data: bytes) -> tuple[bytes, int]:
+    def run_with_rss(
+        self, binary_path: Path, input_data: bytes | Path, args: list[str] | None = None
+    ) -> tuple[bytes, int | None]:
         """Run a compiled C program and return output plus peak RSS (KB)."""
-        res, rss_kb = _run_with_optional_rss([str(binary_path)], input_data, measure_rss=True)
+        res, rss_kb = _run_with_optional_rss(
+            [str(binary_path)] + (args or []), input_data, measure_rss=True
+        )
         if res.returncode != 0:
             raise RuntimeError(f"C execution failed: {res.stderr.decode(errors='replace')}")
         return res.stdout, rss_kb
@@ -500,13 +1914,34 @@ class CRunner:
 class RustRunner:
     """Runner for Rust programs."""
 
-    def __init__(self, rustc: str = "rustc"):
+    def __init__(self, rustc: str = "rustc", cache: BuildCache | None = None):
         self.rustc = rustc
+        self.cache = cache
+        self.last_flags: list[str] = []
 
-    def compile(self, source_path: Path, output_path: Path, optimize: bool = True) -> float:
-        """Compile a Rust program, returning compile time in ms."""
-        flags = ["-C", "opt-level=3", "-C", "target-cpu=native"] if optimize else []
+    def compile(
+        self,
+        source_path: Path,
+        output_path: Path,
+        optimize: bool = True,
+        opt_flags: list[str] | None = None,
+    ) -> float:
+        """Compile a Rust program, returning compile time in ms.
+
+        `opt_flags` replaces RUST_OPT_FLAGS (see BUILD_VARIANTS).
+        """
+        flags = list(opt_flags) if opt_flags is not None else RUST_OPT_FLAGS if optimize else []
+        self.last_flags = flags
+        files = [source_path] + _rust_module_files([source_path])
+        return _cached_compile(
+            self.cache,
+            ["rust", _tool_identity(self.rustc, "-vV")] + flags,
+            files,
+            output_path,
+            lambda: self._compile(source_path, output_path, flags),
+        )
 
+    def _compile(self, source_path: Path, output_path: Path, flags: list[str]) -> float:
         start = time.perf_counter()
         result = subprocess.run(
             [self.rustc] + flags + ["-o", str(output_path), str(source_path)],
@@ -520,24 +1955,31 @@ class RustRunner:
 
         return compile_time
 
-    def run(self, binary_path: Path, input_data: bytes) -> tuple[bytes, float]:
+    def run(
+        self, binary_path: Path, input_data: bytes | Path, args: list[str] | None = None
+    ) -> tuple[bytes, float]:
         """Run a compiled Rust program, returning output and time in ms."""
-        start = time.perf_counter()
-        result = subprocess.run(
-            [str(binary_path)],
-            input=input_data,
-            capture_output=True,
-        )
-        run_time = (time.perf_counter() - start) * 1000
+        with _stdin(input_data) as stdin:
+            start = time.perf_counter()
+            result = subprocess.run(
+                [str(binary_path)] + (args or []),
+                **stdin,
+                capture_output=True,
+            )
+            run_time = (time.perf_counter() - start) * 1000
 
         if result.returncode != 0:
             raise RuntimeError(f"Rust execution failed: {result.stderr.decode()}")
 
         return result.stdout, run_time
 
-    def run_with_rss(self, binary_path: Path, input_data: bytes) -> tuple[bytes, int]:
+    def run_with_rss(
+        self, binary_path: Path, input_data: bytes | Path, args: list[str] | None = None
+    ) -> tuple[bytes, int | None]:
         """Run a compiled Rust program and return output plus peak RSS (KB)."""
-        res, rss_kb = _run_with_optional_rss([str(binary_path)], input_data, measure_rss=True)
+        res, rss_kb = _run_with_optional_rss(
+            [str(binary_path)] + (args or []), input_data, measure_rss=True
+        )
         if res.returncode != 0:
             raise RuntimeError(f"Rust execution failed: {res.stderr.decode(errors='replace')}")
         return res.stdout, rss_kb
@@ -546,11 +1988,27 @@ class RustRunner:
 class GoRunner:
     """Runner for Go programs."""
 
-    def __init__(self, go: str = "go"):
+    def __init__(self, go: str = "go", cache: BuildCache | None = None):
         self.go = go
+        self.cache = cache
+        self.last_flags: list[str] = []
 
     def compile(self, source_path: Path, output_path: Path) -> float:
         """Compile a Go program, returning compile time in ms."""
+        self.last_flags = GO_BUILD_FLAGS
+        files = [source_path]
+        harness = source_path.parent / "bench.go"
+        if harness.exists() and harness != source_path:
+            files.append(harness)
+        return _cached_compile(
+            self.cache,
+            ["go", _tool_identity(self.go, "version"), "CGO_ENABLED=0"] + GO_BUILD_FLAGS,
+            files,
+            output_path,
+            lambda: self._compile(source_path, output_path),
+        )
+
+    def _compile(self, source_path: Path, output_path: Path) -> float:
         env = os.environ.copy()
         env["CGO_ENABLED"] = "0"
 
@@ -558,19 +2016,15 @@ class GoRunner:
         cache_dir.mkdir(parents=True, exist_ok=True)
         env["GOCACHE"] = str(cache_dir)
 
+        # Programs in go/ share the harness in bench.go (package main).
+        sources = [str(source_path)]
+        harness = source_path.parent / "bench.go"
+        if harness.exists() and harness != source_path:
+            sources.append(str(harness))
+
         start = time.perf_counter()
         result = subprocess.run(
-            [
-                self.go,
-                "build",
-                "-trimpath",
-                "-buildvcs=false",
-                "-ldflags",
-                "-s -w",
-                "-o",
-                str(output_path),
-                str(source_path),
-            ],
+            [self.go, "build"] + GO_BUILD_FLAGS + ["-o", str(output_path)] + sources,
             capture_output=True,
             text=True,
             env=env,
@@ -582,24 +2036,31 @@ class GoRunner:
 
         return compile_time
 
-    def run(self, binary_path: Path, input_data: bytes) -> tuple[bytes, float]:
+    def run(
+        self, binary_path: Path, input_data: bytes | Path, args: list[str] | None = None
+    ) -> tuple[bytes, float]:
         """Run a compiled Go program, returning output and time in ms."""
-        start = time.perf_counter()
-        result = subprocess.run(
-            [str(binary_path)],
-            input=input_data,
-            capture_output=True,
-        )
-        run_time = (time.perf_counter() - start) * 1000
+        with _stdin(input_data) as stdin:
+            start = time.perf_counter()
+            result = subprocess.run(
+                [str(binary_path)] + (args or []),
+                **stdin,
+                capture_output=True,
+            )
+            run_time = (time.perf_counter() - start) * 1000
 
         if result.returncode != 0:
             raise RuntimeError(f"Go execution failed: {result.stderr.decode()}")
 
         return result.stdout, run_time
 
-    def run_with_rss(self, binary_path: Path, input_data: bytes) -> tuple[bytes, int]:
+    def run_with_rss(
+        self, binary_path: Path, input_data: bytes | Path, args: list[str] | None = None
+    ) -> tuple[bytes, int | None]:
         """Run a compiled Go program and return output plus peak RSS (KB)."""
-        res, rss_kb = _run_with_optional_rss([str(binary_path)], input_data, measure_rss=True)
+        res, rss_kb = _run_with_optional_rss(
+            [str(binary_path)] + (args or []), input_data, measure_rss=True
+        )
         if res.returncode != 0:
             raise RuntimeError(f"Go execution failed: {res.stderr.decode(errors='replace')}")
         return res.stdout, rss_kb
@@ -608,14 +2069,61 @@ class GoRunner:
 class RustCargoRunner:
     """Runner for Rust programs using Cargo (for external dependencies)."""
 
-    def compile(self, project_dir: Path, output_path: Path) -> float:
-        """Compile a Cargo project, returning compile time in ms."""
+    def __init__(self, cache: BuildCache | None = None):
+        self.cache = cache
+        self.last_flags: list[str] = []
+
+    def compile(
+        self,
+        project_dir: Path,
+        output_path: Path,
+        env: dict[str, str] | None = None,
+        target_dir: Path | None = None,
+    ) -> float:
+        """Compile a Cargo project, returning compile time in ms.
+
+        `env` adds Cargo settings such as CARGO_PROFILE_RELEASE_LTO (see
+        BUILD_VARIANTS); such builds should get their own `target_dir`, so
+        they do not rebuild over the default one.
+
+        Without a Cargo.lock the cache key cannot see dependency updates;
+        use --fresh-compile after `cargo update` in that case.
+        """
+        self.last_flags = CARGO_BUILD_FLAGS + [f"{k}={v}" for k, v in sorted((env or {}).items())]
+        files = _tree_files(project_dir)
+        # The harness and shared kernels the crate pulls in with #[path].
+        files += [
+            f for f in _rust_module_files([f for f in files if f.suffix == ".rs"])
+            if f not in files
+        ]
+        return _cached_compile(
+            self.cache,
+            ["cargo", _tool_identity("cargo", "-V"), _tool_identity("rustc", "-vV")]
+            + self.last_flags,
+            files,
+            output_path,
+            lambda: self._compile(project_dir, output_path, env, target_dir),
+        )
+
+    def _compile(
+        self,
+        project_dir: Path,
+        output_path: Path,
+        env: dict[str, str] | None = None,
+        target_dir: Path | None = None,
+    ) -> float:
+        run_env = None
+        if env or target_dir:
+            run_env = dict(os.environ, **(env or {}))
+            if target_dir:
+                run_env["CARGO_TARGET_DIR"] = str(target_dir)
         start = time.perf_counter()
         result = subprocess.run(
-            ["cargo", "build", "--release"],
+            ["cargo", "build"] + CARGO_BUILD_FLAGS,
             capture_output=True,
             text=True,
             cwd=str(project_dir),
+            env=run_env,
         )
         compile_time = (time.perf_counter() - start) * 1000
 
@@ -624,7 +2132,7 @@ class RustCargoRunner:
 
         # Copy the binary to the output path
         binary_name = project_dir.name
-        src_binary = project_dir / "target" / "release" / binary_name
+        src_binary = (target_dir or project_dir / "target") / "release" / binary_name
         if not src_binary.exists():
             raise RuntimeError(f"Cargo build succeeded but binary not found: {src_binary}")
 
@@ -633,24 +2141,31 @@ class RustCargoRunner:
 
         return compile_time
 
-    def run(self, binary_path: Path, input_data: bytes) -> tuple[bytes, float]:
+    def run(
+        self, binary_path: Path, input_data: bytes | Path, args: list[str] | None = None
+    ) -> tuple[bytes, float]:
         """Run a compiled Rust program, returning output and time in ms."""
-        start = time.perf_counter()
-        result = subprocess.run(
-            [str(binary_path)],
-            input=input_data,
-            capture_output=True,
-        )
-        run_time = (time.perf_counter() - start) * 1000
+        with _stdin(input_data) as stdin:
+            start = time.perf_counter()
+            result = subprocess.run(
+                [str(binary_path)] + (args or []),
+                **stdin,
+                capture_output=True,
+            )
+            run_time = (time.perf_counter() - start) * 1000
 
         if result.returncode != 0:
             raise RuntimeError(f"Rust execution failed: {result.stderr.decode()}")
 
         return result.stdout, run_time
 
-    def run_with_rss(self, binary_path: Path, input_data: bytes) -> tuple[bytes, int]:
+    def run_with_rss(
+        self, binary_path: Path, input_data: bytes | Path, args: list[str] | None = None
+    ) -> tuple[bytes, int | None]:
         """Run a compiled Rust program and return output plus peak RSS (KB)."""
-        res, rss_kb = _run_with_optional_rss([str(binary_path)], input_data, measure_rss=True)
+        res, rss_kb = _run_with_optional_rss(
+            [str(binary_path)] + (args or []), input_data, measure_rss=True
+        )
         if res.returncode != 0:
             raise RuntimeError(f"Rust execution failed: {res.stderr.decode(errors='replace')}")
         return res.stdout, rss_kb
@@ -659,19 +2174,35 @@ class RustCargoRunner:
 class X07ProjectRunner:
     """Runner for X07 projects (with package dependencies)."""
 
-    def __init__(self, host_runner: Path, cc_profile: str = "default"):
+    def __init__(
+        self, host_runner: Path, cc_profile: str = "default", cache: BuildCache | None = None
+    ):
         self.cwd = host_runner.parent
         self.cc_profile = cc_profile
         self.host_runner = host_runner
+        self.cache = cache
+        self.last_flags: list[str] = []
 
     def compile(self, project_file: Path, artifact_path: Path) -> float:
-        """Compile an X07 project to a native binary, returning compile time in ms."""
+        """Compile an X07 project to a native binary, returning compile time in ms.
+
+        The key covers every file in the project directory (including the
+        entry point and the lockfile that pins package versions).
+        """
+        self.last_flags = _x07_flags(self.cc_profile)
+        return _cached_compile(
+            self.cache,
+            _x07_cache_parts("x07-project", self.host_runner, self.cc_profile),
+            _tree_files(project_file.parent, skip=("target", ".x07")),
+            artifact_path,
+            lambda: self._compile(project_file, artifact_path),
+        )
+
+    def _compile(self, project_file: Path, artifact_path: Path) -> float:
         start = time.perf_counter()
         cmd = _x07_host_runner_prefix(self.host_runner, self.cc_profile) + [
             "--project", str(project_file),
-            "--world", "solve-pure",
-            "--solve-fuel", "500000000",
-            "--max-memory-bytes", str(256 * 1024 * 1024),
+        ] + X07_COMPILE_FLAGS + [
             "--compiled-out", str(artifact_path),
             "--compile-only",
         ]
@@ -698,188 +2229,1109 @@ class X07ProjectRunner:
 
         return compile_time
 
-    def run_direct(self, binary_path: Path, input_data: bytes) -> tuple[bytes, float]:
+    def run_direct(self, binary_path: Path, input_data: bytes | Path) -> tuple[bytes, float]:
         """Run a compiled X07 project binary directly with length-prefixed I/O."""
-        input_len = len(input_data)
-        prefixed_input = struct.pack("<I", input_len) + input_data
-
-        start = time.perf_counter()
-        result = subprocess.run(
-            [str(binary_path)],
-            input=prefixed_input,
-            capture_output=True,
-        )
-        run_time = (time.perf_counter() - start) * 1000
+        with _stdin(_x07_framed(input_data)) as stdin:
+            start = time.perf_counter()
+            result = subprocess.run(
+                [str(binary_path)],
+                **stdin,
+                capture_output=True,
+            )
+            run_time = (time.perf_counter() - start) * 1000
 
         if result.returncode != 0:
             raise RuntimeError(f"X07 execution failed (exit {result.returncode})")
 
-        raw_output = result.stdout
-        if len(raw_output) < 4:
-            raise RuntimeError(f"X07 output too short: {len(raw_output)} bytes")
-
-        out_len = struct.unpack("<I", raw_output[:4])[0]
-        if len(raw_output) < 4 + out_len:
-            raise RuntimeError(f"X07 output truncated: expected {out_len}, got {len(raw_output) - 4}")
-
-        output_bytes = raw_output[4:4 + out_len]
-        return output_bytes, run_time
+        return _x07_unframed(result.stdout), run_time
 
-    def run_direct_with_rss(self, binary_path: Path, input_data: bytes) -> tuple[bytes, int]:
+    def run_direct_with_rss(self, binary_path: Path, input_data: bytes | Path) -> tuple[bytes, int | None]:
         """Run a compiled X07 project binary directly and return output plus peak RSS (KB)."""
-        input_len = len(input_data)
-        prefixed_input = struct.pack("<I", input_len) + input_data
-
         res, rss_kb = _run_with_optional_rss(
-            [str(binary_path)], prefixed_input, measure_rss=True
+            [str(binary_path)], _x07_framed(input_data), measure_rss=True
         )
         if res.returncode != 0:
             raise RuntimeError(f"X07 execution failed (exit {res.returncode})")
 
-        raw_output = res.stdout
-        if len(raw_output) < 4:
-            raise RuntimeError(f"X07 output too short: {len(raw_output)} bytes")
+        return _x07_unframed(res.stdout), rss_kb
 
-        out_len = struct.unpack("<I", raw_output[:4])[0]
-        if len(raw_output) < 4 + out_len:
-            raise RuntimeError(
-                f"X07 output truncated: expected {out_len}, got {len(raw_output) - 4}"
-            )
 
-        output_bytes = raw_output[4 : 4 + out_len]
-        return output_bytes, rss_kb
+# C I/O layer variants (see c/bench.h): mode -> (result language, BENCH_IO value).
+C_IO_VARIANTS: dict[str, tuple[str, str]] = {
+    "stdio": ("C", "BENCH_IO_STDIO"),
+    "tuned": ("C-io", "BENCH_IO_MMAP"),
+}
 
 
-def run_benchmark(
-    benchmark: str,
-    input_data: InputData,
-    x07_host_runner: Path,
-    perf_repo_root: Path,
-    tmp_dir: Path,
-    iterations: int = 5,
-    warmup: int = 1,
-    direct_mode: bool = False,
-    x07_cc_profile: str = "default",
-) -> list[BenchmarkResult]:
-    """Run a benchmark across all languages."""
-    results = []
+def _c_io_modes(c_io: str) -> list[str]:
+    if c_io == "both":
+        return ["stdio", "tuned"]
+    return [c_io]
 
-    perf_dir = perf_repo_root
-    c_runner = CRunner()
-    rust_runner = RustRunner()
-    go_runner = GoRunner()
 
-    x07_prog = perf_dir / "x07" / f"{benchmark}.x07.json"
-    c_prog = perf_dir / "c" / f"{benchmark}.c"
-    rust_prog = perf_dir / "rust" / f"{benchmark}.rs"
-    go_prog = perf_dir / "go" / f"{benchmark}.go"
+# The benchmark harnesses (c/bench.h, rust/bench.rs, go/bench.go) print
+# "BENCH_KERNEL_NS <ns>" on stderr when this variable is set.
+KERNEL_TIMING_ENV = "BENCH_KERNEL_TIMING"
 
-    # Check for project-based X07 (e.g., regex benchmarks)
-    x07_project = None
-    if benchmark.startswith("regex_"):
-        entry_map = {
-            "regex_is_match": "src/is_match.x07.json",
-            "regex_count": "src/count.x07.json",
-            "regex_replace": "src/replace.x07.json",
-        }
-        if benchmark in entry_map:
-            project_dir = perf_dir / "projects" / "regex"
-            project_file = project_dir / "x07.json"
-            if project_file.exists():
-                x07_project = (project_file, entry_map[benchmark])
 
-    # Check for cargo-based Rust (e.g., regex benchmarks)
-    rust_cargo_proj = perf_dir / "rust_cargo" / benchmark
-    rust_cargo_exists = (rust_cargo_proj / "Cargo.toml").exists()
+def _parse_kernel_ns(stderr: bytes) -> int | None:
+    for line in stderr.decode(errors="replace").splitlines():
+        if line.startswith("BENCH_KERNEL_NS "):
+            try:
+                return int(line.split()[1])
+            except (IndexError, ValueError):
+                return None
+    return None
+
+
+def _run_kernel_timed(
+    cmd: list[str], input_data: bytes | Path
+) -> tuple[bytes, float, float | None]:
+    """Run `cmd` with kernel timing enabled.
+
+    Returns output, wall time in ms, and the program's kernel time in ms, or
+    None when the program does not go through a timing harness.
+    """
+    env = dict(os.environ)
+    env[KERNEL_TIMING_ENV] = "1"
+    with _stdin(input_data) as stdin:
+        start = time.perf_counter()
+        res = subprocess.run(cmd, **stdin, capture_output=True, env=env)
+        run_time = (time.perf_counter() - start) * 1000
 
-    reference_output = None
+    if res.returncode != 0:
+        raise RuntimeError(f"Execution failed: {res.stderr.decode(errors='replace')}")
 
-    # Priority: project-based X07 over single-file X07
-    if x07_project is not None:
-        project_file, entry = x07_project
-        result = BenchmarkResult(language="X07", benchmark=benchmark)
-        original_project_text = project_file.read_text()
+    ns = _parse_kernel_ns(res.stderr)
+    return res.stdout, run_time, ns / 1e6 if ns is not None else None
+
+
+def _time_startup_probe(run: Any, iterations: int) -> list[float]:
+    """Wall times of `run()` on an empty input; [] if the program rejects it.
+
+    X07 programs cannot time themselves, so their startup cost is estimated
+    as the time of a run that has (nearly) no work to do.
+    """
+    times = []
+    try:
+        for _ in range(iterations):
+            start = time.perf_counter()
+            run()
+            times.append((time.perf_counter() - start) * 1000)
+    except Exception:
+        return []
+    return times
+
+
+# With this variable set the benchmark harnesses answer length-prefixed
+# requests in a loop instead of processing stdin once.
+SERVE_ENV = "BENCH_SERVE"
+
+
+def _percentile(sorted_values: list[float], p: float) -> float:
+    """Nearest-rank percentile of an ascending list."""
+    if not sorted_values:
+        return 0.0
+    rank = min(max(math.ceil(p * len(sorted_values)), 1), len(sorted_values))
+    return sorted_values[rank - 1]
+
+
+def _measure_serve(
+    cmd: list[str], input_data: bytes, expected: bytes, requests: int, warmup: int
+) -> dict[str, float]:
+    """Send `requests` copies of the input to one server-mode process, one at a time.
+
+    Latency is the round trip seen by the runner: writing the request frame
+    until the whole response frame has been read.
+    """
+    env = dict(os.environ)
+    env[SERVE_ENV] = "1"
+    frame = _x07_prefixed(input_data)
+    with tempfile.TemporaryFile() as stderr:
+        proc = subprocess.Popen(
+            cmd, stdin=subprocess.PIPE, stdout=subprocess.PIPE, stderr=stderr, env=env
+        )
+        assert proc.stdin is not None and proc.stdout is not None
+
+        def round_trip() -> bytes:
+            proc.stdin.write(frame)
+            proc.stdin.flush()
+            hdr = proc.stdout.read(4)
+            if len(hdr) < 4:
+                raise RuntimeError("server exited before responding")
+            n = struct.unpack("<I", hdr)[0]
+            body = proc.stdout.read(n)
+            if len(body) < n:
+                raise RuntimeError(f"server response truncated: expected {n}, got {len(body)}")
+            return body
+
+        latencies_us = []
         try:
-            # Update project to use the right entry
-            project_dir = project_file.parent
-            project_data = json.loads(original_project_text)
-            project_data["entry"] = entry
-            project_file.write_text(json.dumps(project_data, indent=2))
+            for _ in range(warmup):
+                if round_trip() != expected:
+                    raise RuntimeError("Server-mode output mismatch with single-shot output")
+            start = time.perf_counter()
+            for _ in range(requests):
+                t0 = time.perf_counter_ns()
+                round_trip()
+                latencies_us.append((time.perf_counter_ns() - t0) / 1000)
+            elapsed = time.perf_counter() - start
+            proc.stdin.close()
+            proc.wait(timeout=30)
+        except (BrokenPipeError, RuntimeError) as e:
+            proc.kill()
+            proc.wait()
+            stderr.seek(0)
+            raise RuntimeError(f"{e}: {stderr.read().decode(errors='replace')[:200]}")
+
+    latencies_us.sort()
+    return {
+        "requests": float(requests),
+        "mean_us": statistics.mean(latencies_us),
+        "p50_us": _percentile(latencies_us, 0.50),
+        "p99_us": _percentile(latencies_us, 0.99),
+        "p999_us": _percentile(latencies_us, 0.999),
+        "requests_per_s": requests / elapsed if elapsed > 0 else 0.0,
+    }
+
+
+def _sample_times(
+    run_once: Callable[[], float],
+    opts: MeasureOptions,
+    run_batch: Callable[[int], list[float]] | None = None,
+) -> list[float]:
+    """Collect timed runs: opts.iterations of them, then more while adaptive
+    sampling is on and the median's CI is still wider than opts.target_ci.
+
+    With `run_batch(n)` the runs are taken n at a time: first
+    opts.iterations, then up to that many more per adaptive round.
+    """
+    times: list[float] = []
+    start = time.perf_counter()
+
+    def wants_more() -> bool:
+        if not opts.target_ci or len(times) >= opts.max_iterations:
+            return False
+        if time.perf_counter() - start >= opts.time_budget_s:
+            return False
+        ci = median_rank_ci(sorted(times))
+        med = statistics.median(times)
+        return ci is None or med <= 0 or (ci[1] - ci[0]) / 2 > opts.target_ci * med
+
+    if run_batch is not None:
+        times.extend(run_batch(opts.iterations))
+        while wants_more():
+            times.extend(run_batch(min(opts.iterations, opts.max_iterations - len(times))))
+        return times
+
+    while len(times) < opts.iterations or wants_more():
+        times.append(run_once())
+    return times
+
+
+def _launch_batch(
+    launcher: Path,
+    cmd: list[str],
+    input_data: bytes | Path,
+    warmup: int,
+    runs: int,
+    env: dict[str, str] | None = None,
+) -> tuple[bytes, list[float], list[dict[str, int]]]:
+    """Run `cmd` warmup + runs times under tools/launcher.c.
+
+    Returns the last run's output, the timed runs' wall times in ms, and
+    their rusage (user_ns, sys_ns, minflt, majflt). The launcher times each
+    run around posix_spawn and wait4, so Python's own process handling is
+    not in the times. Raw input bytes go through a temporary file, because
+    the launcher hands every run the same pre-opened file; no run reads a
+    pipe, which is why main rejects --pipe-input with the launcher.
+    """
+    with tempfile.TemporaryDirectory(prefix="x07-launch-") as tmp:
+        input_path = input_data if isinstance(input_data, Path) else Path(tmp) / "input.bin"
+        if not isinstance(input_data, Path):
+            input_path.write_bytes(input_data)
+        output_path = Path(tmp) / "output.bin"
+        res = subprocess.run(
+            [str(launcher), "-i", str(input_path), "-o", str(output_path),
+             "-w", str(warmup), "-n", str(runs), "--"] + cmd,
+            capture_output=True,
+            text=True,
+            env=env,
+        )
+        if res.returncode != 0:
+            raise RuntimeError(f"execution failed: {res.stderr.strip()}")
+        output = output_path.read_bytes()
 
-            x07_runner = X07Runner(x07_host_runner, cc_profile=x07_cc_profile)
-            project_runner = X07ProjectRunner(x07_host_runner, cc_profile=x07_cc_profile)
-            artifact = tmp_dir / f"{benchmark}_x07"
+    times, rusage = [], []
+    for line in res.stdout.splitlines():
+        if line.startswith("BENCH_LAUNCH "):
+            fields = {k: int(v) for k, _, v in (f.partition("=") for f in line.split()[1:])}
+            times.append(fields.pop("wall_ns") / 1e6)
+            rusage.append(fields)
+    return output, times, rusage
 
-            result.compile_time_ms = project_runner.compile(project_file, artifact)
-            result.build_size_bytes = artifact.stat().st_size
 
-            output, rss_kb = project_runner.run_direct_with_rss(artifact, input_data.data)
-            result.output_bytes = output
-            result.peak_rss_kb = rss_kb
-            if reference_output is None:
-                reference_output = output
+def _record_memory(result: BenchmarkResult, profile: dict[str, Any]) -> None:
+    result.rss_timeline_kb = profile.pop("timeline")
+    result.memory_runs.append(profile)
 
-            for _ in range(warmup):
-                if direct_mode:
-                    project_runner.run_direct(artifact, input_data.data)
-                else:
-                    x07_runner.run_cached(artifact, input_data.data)
 
-            if direct_mode:
-                for _ in range(iterations):
-                    output, run_time = project_runner.run_direct(artifact, input_data.data)
-                    result.times_ms.append(run_time)
+def _measure_native(
+    result: BenchmarkResult,
+    runner: Any,
+    binary: Path,
+    input_data: InputData,
+    opts: MeasureOptions,
+    reference_output: bytes | None,
+    args: list[str] | None = None,
+    serve: bool = False,
+) -> bytes | None:
+    """Measure RSS, counters, warmup and timed runs of a compiled native binary.
+
+    `serve` marks programs built on a benchmark harness, which also get a
+    server-mode run when opts.serve_requests is set. Returns the reference
+    output to compare later languages against: the existing one, or this
+    binary's output when no reference exists yet.
+    """
+    result.build_size_bytes = binary.stat().st_size
+    result.build_flags = list(getattr(runner, "last_flags", []))
+    result.compile_cached = _compile_replayed(opts, binary)
+    # A PreloadRunner re-running a direct X07 binary needs the framed input.
+    stdin = input_data.x07_stdin if getattr(runner, "framed", False) else input_data.stdin
+
+    with _pinned(opts.core):
+        output, rss_kb = runner.run_with_rss(binary, stdin, args)
+        result.peak_rss_kb = rss_kb
+
+        if opts.counters:
+            result.counters = _run_with_counters(
+                [str(binary)] + (args or []), stdin, binary.parent
+            )
+
+        # Kernel timing and --memory need the runs' stderr and pid, so they
+        # stay on the Python path.
+        launched = opts.launcher is not None and not (opts.kernel_timing or opts.memory)
+        if not launched:
+            for _ in range(opts.warmup):
+                runner.run(binary, stdin, args)
+        warmup_left = opts.warmup
+
+        def timed_batch(n: int) -> list[float]:
+            nonlocal output, warmup_left
+            raw, times, rusage = _launch_batch(
+                opts.launcher, [str(binary)] + (args or []), stdin, warmup_left, n,
+                getattr(runner, "env", None),
+            )
+            warmup_left = 0
+            output = _x07_unframed(raw) if getattr(runner, "framed", False) else raw
+            result.launch_rusage.extend(rusage)
+            return times
+
+        def timed_run() -> float:
+            nonlocal output
+            if opts.kernel_timing:
+                output, run_time, kernel_ms = _run_kernel_timed(
+                    [str(binary)] + (args or []), stdin
+                )
+                if kernel_ms is not None:
+                    result.kernel_times_ms.append(kernel_ms)
+            elif opts.memory:
+                res, run_time, profile = _run_memory_sampled(
+                    [str(binary)] + (args or []), stdin, opts.core, getattr(runner, "env", None)
+                )
+                if res.returncode != 0:
+                    raise RuntimeError(f"execution failed (exit {res.returncode})")
+                output = _x07_unframed(res.stdout) if getattr(runner, "framed", False) else res.stdout
+                _record_memory(result, profile)
             else:
-                for _ in range(iterations):
-                    start = time.perf_counter()
-                    output, _metrics = x07_runner.run_cached(artifact, input_data.data)
-                    result.times_ms.append((time.perf_counter() - start) * 1000)
+                output, run_time = runner.run(binary, stdin, args)
+            return run_time
+
+        result.times_ms = _sample_times(timed_run, opts, timed_batch if launched else None)
+        result.output_bytes = output
+
+        if serve and opts.serve_requests:
+            result.serve = _measure_serve(
+                [str(binary)] + (args or []),
+                input_data.data,
+                output,
+                opts.serve_requests,
+                max(opts.warmup, opts.serve_requests // 10),
+            )
 
-            if reference_output is not None and output != reference_output:
-                result.error = "Output mismatch with reference"
+    if reference_output is None:
+        return output
+    if output != reference_output:
+        result.error = "Output mismatch with reference"
+    return reference_output
+
+
+# Unit suffixes of the duration fields in an x07-host-runner report. The
+# report has no fixed timing schema, so fields keep the names the runner
+# gave them; those with one of these suffixes are shown as phases.
+_DURATION_UNITS = {"_ms": 1.0, "_us": 1e-3, "_ns": 1e-6}
+
+
+def _report_numbers(report: dict[str, Any], prefix: str = "") -> dict[str, float]:
+    """Every numeric field of an x07-host-runner report, by dotted path, unconverted."""
+    numbers: dict[str, float] = {}
+    for key, value in report.items():
+        name = prefix + key
+        if isinstance(value, dict):
+            numbers.update(_report_numbers(value, name + "."))
+        elif isinstance(value, (int, float)) and not isinstance(value, bool):
+            numbers[name] = float(value)
+    return numbers
+
+
+def _report_durations_ms(numbers: dict[str, float]) -> dict[str, float]:
+    """The duration fields of _report_numbers output, in ms."""
+    durations = {}
+    for name, value in numbers.items():
+        for suffix, scale in _DURATION_UNITS.items():
+            if name.endswith(suffix):
+                durations[name] = value * scale
+    return durations
+
+
+def _measure_x07(
+    result: BenchmarkResult,
+    direct_runner: Any,
+    x07_runner: X07Runner,
+    artifact: Path,
+    input_data: InputData,
+    opts: MeasureOptions,
+    direct_mode: bool,
+    reference_output: bytes | None,
+) -> bytes | None:
+    """Measure a compiled X07 artifact, directly or through x07-host-runner.
+
+    `direct_runner` is an X07DirectRunner or X07ProjectRunner. Returns the
+    reference output, like _measure_native.
+    """
+    result.build_size_bytes = artifact.stat().st_size
+    result.build_flags = list(getattr(direct_runner, "last_flags", []))
+    result.compile_cached = _compile_replayed(opts, artifact)
+
+    report: dict[str, Any] = {}
+
+    def run_sampled() -> tuple[bytes, float]:
+        res, run_time, profile = _run_memory_sampled(
+            [str(artifact)], _x07_framed(input_data.x07_stdin), opts.core
+        )
+        if res.returncode != 0:
+            raise RuntimeError(f"X07 execution failed (exit {res.returncode})")
+        _record_memory(result, profile)
+        return _x07_unframed(res.stdout), run_time
+
+    # Host-runner runs stay on the Python path, which keeps each run's report.
+    # Kernel timing does too, so its empty-input startup probe, which runs
+    # from Python, is timed the same way as the runs it is subtracted from.
+    launched = opts.launcher is not None and not (opts.kernel_timing or opts.memory)
+    warmup_left = opts.warmup
+
+    def direct_batch(n: int) -> list[float]:
+        nonlocal output, warmup_left
+        raw, times, rusage = _launch_batch(
+            opts.launcher, [str(artifact)], _x07_framed(input_data.x07_stdin), warmup_left, n
+        )
+        warmup_left = 0
+        output = _x07_unframed(raw)
+        result.launch_rusage.extend(rusage)
+        return times
+
+    def run_once(inp: InputData) -> tuple[bytes, float]:
+        nonlocal report
+        if direct_mode:
+            return direct_runner.run_direct(artifact, inp.x07_stdin)
+        start = time.perf_counter()
+        out, report = x07_runner.run_cached(artifact, inp.stdin)
+        return out, (time.perf_counter() - start) * 1000
+
+    with _pinned(opts.core):
+        output, rss_kb = direct_runner.run_direct_with_rss(artifact, input_data.x07_stdin)
+        result.output_bytes = output
+        result.peak_rss_kb = rss_kb
+        if reference_output is None:
+            reference_output = output
+
+        # Counters always come from the direct binary, so they describe the
+        # compiled program rather than x07-host-runner.
+        if opts.counters:
+            result.counters = _run_with_counters(
+                [str(artifact)], _x07_framed(input_data.x07_stdin), artifact.parent
+            )
+
+        if not (direct_mode and launched):
+            for _ in range(opts.warmup):
+                run_once(input_data)
+
+        def direct_run() -> float:
+            """One run without the host runner, for the host vs direct breakdown.
+
+            Like the counters, --memory samples these, so it describes the
+            compiled program rather than x07-host-runner.
+            """
+            nonlocal output
+            host_output = output
+            if launched:
+                run_time = direct_batch(1)[0]
+            elif opts.memory:
+                run_time = run_sampled()[1]
+            else:
+                run_time = direct_runner.run_direct(artifact, input_data.x07_stdin)[1]
+            output = host_output
+            return run_time
+
+        def timed_run() -> float:
+            nonlocal output
+            if direct_mode and opts.memory:
+                output, run_time = run_sampled()
+            else:
+                output, run_time = run_once(input_data)
+            if not direct_mode:
+                result.host_reports.append(_report_numbers(report))
+                # Interleaved with the host runs, so drift hits both alike.
+                result.direct_times_ms.append(direct_run())
+            return run_time
+
+        result.times_ms = _sample_times(
+            timed_run, opts, direct_batch if direct_mode and launched else None
+        )
+        if not direct_mode:
+            result.launch_rusage.clear()
+
+        if opts.kernel_timing:
+            result.startup_times_ms = _time_startup_probe(
+                lambda: run_once(InputData(name="empty", data=b"", size_kb=0)), opts.iterations
+            )
+
+    if output != reference_output:
+        result.error = "Output mismatch with reference"
+    return reference_output
+
+
+# Shared-library names tried for each --allocators entry, most specific first.
+ALLOCATOR_LIBS: dict[str, list[str]] = {
+    "jemalloc": ["libjemalloc.so.2", "libjemalloc.so", "libjemalloc.2.dylib", "libjemalloc.dylib"],
+    "mimalloc": ["libmimalloc.so.2", "libmimalloc.so", "libmimalloc.2.dylib", "libmimalloc.dylib"],
+    "tcmalloc": [
+        "libtcmalloc_minimal.so.4", "libtcmalloc.so.4", "libtcmalloc_minimal.4.dylib",
+        "libtcmalloc.dylib",
+    ],
+}
+
+_ALLOCATOR_DIRS = [
+    "/usr/lib/x86_64-linux-gnu", "/usr/lib/aarch64-linux-gnu", "/usr/lib64", "/usr/lib",
+    "/usr/local/lib", "/opt/homebrew/lib", "/usr/local/opt/jemalloc/lib",
+    "/usr/local/opt/mimalloc/lib",
+]
+
+ALLOC_COUNT_SOURCE = Path("tools") / "alloc_count.c"
+
+
+def _preload_var() -> str:
+    return "DYLD_INSERT_LIBRARIES" if sys.platform == "darwin" else "LD_PRELOAD"
+
+
+def find_allocator(name: str) -> Path | None:
+    """Locate an allocator's shared library via ldconfig or the usual lib dirs."""
+    candidates = ALLOCATOR_LIBS.get(name, [])
+    if sys.platform.startswith("linux") and shutil.which("ldconfig"):
+        listing = subprocess.run(["ldconfig", "-p"], capture_output=True, text=True).stdout
+        for lib in candidates:
+            for line in listing.splitlines():
+                if line.strip().startswith(lib + " ") and "=>" in line:
+                    return Path(line.split("=>", 1)[1].strip())
+    for d in _ALLOCATOR_DIRS:
+        for lib in candidates:
+            p = Path(d) / lib
+            if p.exists():
+                return p
+    return None
+
+
+def resolve_allocators(spec: str) -> tuple[list[tuple[str, Path]], list[str]]:
+    """Parse --allocators (`name`, `name=/path/lib.so` or `auto`).
+
+    Returns the usable (name, library) pairs and the names that were not
+    found. `system`/`glibc` name the default allocator, which is the
+    existing row, so they add nothing.
+    """
+    found, missing = [], []
+    for entry in [e.strip() for e in spec.split(",") if e.strip()]:
+        if entry in ("system", "glibc", "libc"):
+            continue
+        if entry == "auto":
+            for name in ALLOCATOR_LIBS:
+                lib = find_allocator(name)
+                if lib and name not in [n for n, _ in found]:
+                    found.append((name, lib))
+            continue
+        name, _, path = entry.partition("=")
+        lib = Path(path).expanduser() if path else find_allocator(name)
+        if lib is None or not lib.exists():
+            missing.append(name)
+        else:
+            found.append((name, lib))
+    return found, missing
+
+
+def _preload_env(lib: Path) -> dict[str, str]:
+    env = os.environ.copy()
+    var = _preload_var()
+    env[var] = f"{lib}:{env[var]}" if env.get(var) else str(lib)
+    return env
+
+
+class PreloadRunner:
+    """Runs an already-built benchmark binary with a library preloaded.
+
+    `framed` selects the X07 direct-binary ABI (u32 LE length around input
+    and output); other programs read stdin and write stdout as-is.
+    """
 
+    def __init__(self, lib: Path, framed: bool):
+        self.env = _preload_env(lib)
+        self.framed = framed
+
+    def _invoke(
+        self,
+        binary_path: Path,
+        input_data: bytes | Path,
+        args: list[str] | None,
+        measure_rss: bool,
+    ) -> tuple[bytes, int | None]:
+        payload = _x07_framed(input_data) if self.framed else input_data
+        res, rss_kb = _run_with_optional_rss(
+            [str(binary_path)] + (args or []), payload, env=self.env, measure_rss=measure_rss
+        )
+        if res.returncode != 0:
+            raise RuntimeError(
+                f"execution failed (exit {res.returncode}): {res.stderr.decode(errors='replace')}"
+            )
+        return (_x07_unframed(res.stdout) if self.framed else res.stdout), rss_kb
+
+    def run(
+        self, binary_path: Path, input_data: bytes | Path, args: list[str] | None = None
+    ) -> tuple[bytes, float]:
+        start = time.perf_counter()
+        out, _ = self._invoke(binary_path, input_data, args, measure_rss=False)
+        return out, (time.perf_counter() - start) * 1000
+
+    def run_with_rss(
+        self, binary_path: Path, input_data: bytes | Path, args: list[str] | None = None
+    ) -> tuple[bytes, int | None]:
+        return self._invoke(binary_path, input_data, args, measure_rss=True)
+
+
+def _parse_alloc_counts(stderr: str) -> dict[str, int]:
+    for line in reversed(stderr.splitlines()):
+        if line.startswith("BENCH_ALLOC "):
+            return {k: int(v) for k, _, v in (f.partition("=") for f in line.split()[1:])}
+    return {}
+
+
+def _count_allocations(
+    binary: Path, input_data: bytes | Path, counter_lib: Path, framed: bool
+) -> dict[str, int]:
+    """One run under the counting interposer; see tools/alloc_count.c."""
+    payload = _x07_framed(input_data) if framed else input_data
+    with _stdin(payload) as stdin:
+        res = subprocess.run(
+            [str(binary)], **stdin, capture_output=True, env=_preload_env(counter_lib)
+        )
+    if res.returncode != 0:
+        raise RuntimeError(f"execution failed (exit {res.returncode})")
+    counts = _parse_alloc_counts(res.stderr.decode(errors="replace"))
+    if not counts:
+        raise RuntimeError("interposer did not report (static binary or non-glibc libc?)")
+    return counts
+
+
+LAUNCHER_SOURCE = Path("tools") / "launcher.c"
+
+
+def build_launcher(perf_dir: Path, out_dir: Path, cache: BuildCache | None) -> Path:
+    """Build tools/launcher.c, the --launcher native batch timer."""
+    launcher = out_dir / "launcher"
+    CRunner(cache=cache).compile(perf_dir / LAUNCHER_SOURCE, launcher)
+    return launcher
+
+
+def build_alloc_counter(perf_dir: Path, out_dir: Path, cache: BuildCache | None) -> Path:
+    """Build tools/alloc_count.c as a preloadable shared object."""
+    lib = out_dir / "alloc_count.so"
+    CRunner(cache=cache).compile(
+        perf_dir / ALLOC_COUNT_SOURCE, lib, extra_flags=["-shared", "-fPIC"]
+    )
+    return lib
+
+
+def _run_allocator_variants(
+    name: str,
+    lib: Path,
+    targets: list[tuple[BenchmarkResult, Path, bool]],
+    input_data: InputData,
+    opts: MeasureOptions,
+    reference_output: bytes | None,
+) -> tuple[list[BenchmarkResult], bytes | None]:
+    """Re-run each target binary with allocator `lib` preloaded, as `<language>+<name>` rows.
+
+    Counters, kernel timing and server mode stay with the primary rows.
+    """
+    plain = replace(opts, counters=False, kernel_timing=False, serve_requests=0)
+    results = []
+    for base_row, binary, framed in targets:
+        result = BenchmarkResult(language=f"{base_row.language}+{name}", benchmark=base_row.benchmark)
+        result.compile_time_ms = base_row.compile_time_ms
+        try:
+            reference_output = _measure_native(
+                result, PreloadRunner(lib, framed), binary, input_data, plain, reference_output
+            )
         except Exception as e:
             result.success = False
             result.error = str(e)
-        finally:
-            project_file.write_text(original_project_text)
-
+        result.build_flags = base_row.build_flags
         results.append(result)
+    return results, reference_output
 
-    elif x07_prog.exists():
-        result = BenchmarkResult(language="X07", benchmark=benchmark)
+
+# Entry calls of programs built on the shared harness (c/bench.h,
+# rust/bench.rs, go/bench.go); only those can run in server mode.
+_HARNESS_ENTRY = re.compile(r"\b(?:bench_main|bench::run|benchMain)\(")
+
+
+# The *_par programs clamp argv[1] to this (bench_thread_count in c/bench.h
+# and its Rust and Go copies), so larger --threads values would be mislabeled.
+MAX_THREADS = 256
+
+
+def _run_source_variants(
+    benchmark: str,
+    suffix: str,
+    perf_dir: Path,
+    tmp_dir: Path,
+    input_data: InputData,
+    opts: MeasureOptions,
+    reference_output: bytes | None,
+    threads: list[int] | None = None,
+    skip_c: bool = False,
+) -> tuple[list[BenchmarkResult], bytes | None]:
+    """Run the `<benchmark>_<suffix>` implementations found next to the primary ones.
+
+    Each one becomes its own result row named `<language>-<suffix>`. C variants
+    are built against the tuned input layer so they measure the kernel, not stdio.
+    With `threads`, each binary is built once and run per thread count (passed
+    as argv[1]), giving one `<language>-<suffix>/<n>` row per count.
+    `skip_c` leaves out the C variant (see POSIX_REGEX_UNSUPPORTED). Variants
+    built on the benchmark harness also get a server-mode run.
+    """
+    candidates: list[tuple[str, Any, Path]] = [
+        ("C", CRunner(cache=opts.build_cache), perf_dir / "c" / f"{benchmark}_{suffix}.c"),
+        ("Rust", RustRunner(cache=opts.build_cache), perf_dir / "rust" / f"{benchmark}_{suffix}.rs"),
+        ("Go", GoRunner(cache=opts.build_cache), perf_dir / "go" / f"{benchmark}_{suffix}.go"),
+    ]
+
+    results = []
+    for language, runner, source in candidates:
+        if not source.exists() or (skip_c and language == "C"):
+            continue
+        label = f"{language}-{suffix}"
+        binary = tmp_dir / f"{benchmark}_{suffix}_{language.lower()}"
+        compile_time_ms = 0.0
+        compile_error = ""
         try:
-            x07_runner = X07Runner(x07_host_runner, cc_profile=x07_cc_profile)
-            direct_runner = X07DirectRunner(x07_host_runner, cc_profile=x07_cc_profile)
-            artifact = tmp_dir / f"{benchmark}_x07"
+            if language == "C":
+                compile_time_ms = runner.compile(
+                    source, binary, extra_flags=["-DBENCH_IO=BENCH_IO_MMAP", "-pthread"]
+                )
+            else:
+                compile_time_ms = runner.compile(source, binary)
+        except Exception as e:
+            compile_error = str(e)
 
-            result.compile_time_ms = direct_runner.compile(x07_prog, artifact)
-            result.build_size_bytes = artifact.stat().st_size
+        runs = [(label, 0, None)]
+        if threads:
+            runs = [(f"{label}/{n}", n, [str(n)]) for n in threads]
 
-            output, rss_kb = direct_runner.run_direct_with_rss(artifact, input_data.data)
-            result.output_bytes = output
-            result.peak_rss_kb = rss_kb
-            if reference_output is None:
-                reference_output = output
+        for row_label, n, args in runs:
+            result = BenchmarkResult(language=row_label, benchmark=benchmark, threads=n)
+            result.compile_time_ms = compile_time_ms
+            try:
+                if compile_error:
+                    raise RuntimeError(compile_error)
+                reference_output = _measure_native(
+                    result,
+                    runner,
+                    binary,
+                    input_data,
+                    opts,
+                    reference_output,
+                    args,
+                    serve=not threads and bool(_HARNESS_ENTRY.search(source.read_text())),
+                )
 
-            for _ in range(warmup):
-                if direct_mode:
-                    direct_runner.run_direct(artifact, input_data.data)
+            except Exception as e:
+                result.success = False
+                result.error = str(e)
+
+            results.append(result)
+
+    return results, reference_output
+
+
+def _run_x07_source_variant(
+    benchmark: str,
+    suffix: str,
+    perf_dir: Path,
+    tmp_dir: Path,
+    input_data: InputData,
+    opts: MeasureOptions,
+    reference_output: bytes | None,
+    x07_host_runner: Path,
+    x07_cc_profile: str,
+    direct_mode: bool,
+) -> tuple[list[BenchmarkResult], bytes | None]:
+    """Run `x07/<benchmark>_<suffix>.x07.json`, if it exists, as an `X07-<suffix>` row."""
+    x07_prog = perf_dir / "x07" / f"{benchmark}_{suffix}.x07.json"
+    if not x07_prog.exists():
+        return [], reference_output
+    result = BenchmarkResult(language=f"X07-{suffix}", benchmark=benchmark)
+    try:
+        direct_runner = X07DirectRunner(
+            x07_host_runner, cc_profile=x07_cc_profile, cache=opts.build_cache
+        )
+        artifact = tmp_dir / f"{benchmark}_{suffix}_x07"
+        result.compile_time_ms = direct_runner.compile(x07_prog, artifact)
+        reference_output = _measure_x07(
+            result, direct_runner, X07Runner(x07_host_runner, cc_profile=x07_cc_profile),
+            artifact, input_data, opts, direct_mode, reference_output,
+        )
+    except Exception as e:
+        result.success = False
+        result.error = str(e)
+    return [result], reference_output
+
+
+# --build-variants: builds that differ from the default rows in one way.
+# The default rows use -O3 -march=native (C), opt-level=3 with
+# target-cpu=native (rustc), Cargo's release profile and the run's
+# --x07-cc-profile. A variant has no row for a language it has no entry
+# for: Go has no optimization level, LTO or CPU flags to pick, Cargo's
+# release builds are already generic, and X07 only has its cc profiles.
+BUILD_VARIANTS: dict[str, dict[str, Any]] = {
+    "O2": {
+        "c": ["-O2", "-march=native"],
+        "rust": ["-C", "opt-level=2", "-C", "target-cpu=native"],
+        "cargo": {"CARGO_PROFILE_RELEASE_OPT_LEVEL": "2"},
+    },
+    "lto": {
+        "c": C_OPT_FLAGS + ["-flto"],
+        "rust": RUST_OPT_FLAGS + ["-C", "lto=fat", "-C", "codegen-units=1"],
+        "cargo": {"CARGO_PROFILE_RELEASE_LTO": "fat", "CARGO_PROFILE_RELEASE_CODEGEN_UNITS": "1"},
+    },
+    "generic": {
+        "c": ["-O3"],
+        "rust": ["-C", "opt-level=3"],
+    },
+    "size": {
+        "c": ["-Os", "-march=native"],
+        "rust": ["-C", "opt-level=s", "-C", "target-cpu=native"],
+        "cargo": {"CARGO_PROFILE_RELEASE_OPT_LEVEL": "s"},
+        "x07": "size",
+    },
+    # The default flags plus an instrumented build, one training run on the
+    # benchmark input and a rebuild with the profile (see _pgo_build).
+    "pgo": {
+        "c": C_OPT_FLAGS,
+        "rust": RUST_OPT_FLAGS,
+        "cargo": {},
+    },
+}
+
+
+def parse_build_variants(spec: str) -> list[str]:
+    """Parse --build-variants: comma-separated BUILD_VARIANTS names, or `all`."""
+    if spec.strip() == "all":
+        return list(BUILD_VARIANTS)
+    names = [v.strip() for v in spec.split(",") if v.strip()]
+    unknown = [v for v in names if v not in BUILD_VARIANTS]
+    if unknown:
+        raise ValueError(
+            f"unknown build variants: {', '.join(unknown)} (known: {', '.join(BUILD_VARIANTS)}; "
+            "O3 and native are the default rows)"
+        )
+    return names
+
+
+def _llvm_profdata(rust: bool) -> str | None:
+    """An llvm-profdata to merge raw profiles with, or None.
+
+    For Rust, rustup's llvm-tools copy comes first, since the profile format
+    must match rustc's LLVM.
+    """
+    candidates: list[str] = []
+    if rust:
+        sysroot = subprocess.run(
+            ["rustc", "--print", "sysroot"], capture_output=True, text=True
+        ).stdout.strip()
+        if sysroot:
+            candidates += [str(p) for p in sorted(Path(sysroot).glob("lib/rustlib/*/bin/llvm-profdata"))]
+    if shutil.which("llvm-profdata"):
+        candidates.append("llvm-profdata")
+    if sys.platform == "darwin" and shutil.which("xcrun"):
+        found = subprocess.run(
+            ["xcrun", "--find", "llvm-profdata"], capture_output=True, text=True
+        ).stdout.strip()
+        if found:
+            candidates.append(found)
+    for d in os.get_exec_path():
+        candidates += [str(p) for p in sorted(Path(d).glob("llvm-profdata-*"), reverse=True)]
+    return candidates[0] if candidates else None
+
+
+def _pgo_build(
+    build: Callable[[list[str]], float],
+    train: Callable[[], Any],
+    prof_dir: Path,
+    style: str,
+) -> float:
+    """Profile-guided build: instrument, train once, rebuild with the profile.
+
+    `build(flags)` builds with `flags` added to the variant's flags and
+    returns its compile time. `style` is "gcc", "clang" or "rust", which
+    decides the flags and whether the raw profiles need llvm-profdata.
+    Returns the total time of both builds, the training run and the merge.
+    """
+    shutil.rmtree(prof_dir, ignore_errors=True)
+    prof_dir.mkdir(parents=True)
+    rust = style == "rust"
+    total_ms = build(["-C", f"profile-generate={prof_dir}"] if rust else [f"-fprofile-generate={prof_dir}"])
+
+    start = time.perf_counter()
+    train()
+    if style == "gcc":
+        use = [f"-fprofile-use={prof_dir}", "-fprofile-correction", "-Wno-missing-profile"]
+    else:
+        profdata_tool = _llvm_profdata(rust)
+        if profdata_tool is None:
+            raise RuntimeError("PGO needs llvm-profdata (rustup component add llvm-tools)")
+        raw = sorted(prof_dir.rglob("*.profraw"))
+        if not raw:
+            raise RuntimeError("training run wrote no profile")
+        profdata = prof_dir / "merged.profdata"
+        res = subprocess.run(
+            [profdata_tool, "merge", "-o", str(profdata)] + [str(p) for p in raw],
+            capture_output=True,
+            text=True,
+        )
+        if res.returncode != 0:
+            raise RuntimeError(
+                f"llvm-profdata merge failed (its LLVM must match the compiler's): {res.stderr}"
+            )
+        use = ["-C", f"profile-use={profdata}"] if rust else [f"-fprofile-use={profdata}"]
+    total_ms += (time.perf_counter() - start) * 1000
+
+    return total_ms + build(use)
+
+
+def _run_build_variants(
+    benchmark: str,
+    build_variants: list[str],
+    perf_dir: Path,
+    tmp_dir: Path,
+    input_data: InputData,
+    opts: MeasureOptions,
+    reference_output: bytes | None,
+    x07_host_runner: Path,
+    x07_cc_profile: str,
+    direct_mode: bool,
+    c_io: str = "both",
+) -> tuple[list[BenchmarkResult], bytes | None]:
+    """Rebuild the primary programs per BUILD_VARIANTS entry, as `<language>-<variant>` rows.
+
+    C is built once per `c_io` mode, so each variant row extends the row it
+    is named after (`C-O2` the stdio `C` row, `C-io-O2` the tuned one) and
+    differs from it only in the variant. Cached builds are reused, except
+    PGO builds, whose profile comes from this run's input.
+    """
+    base, _case = _split_benchmark(benchmark)
+    c_prog = perf_dir / "c" / f"{base}.c"
+    rust_prog = perf_dir / "rust" / f"{base}.rs"
+    cargo_proj = perf_dir / "rust_cargo" / base
+    x07_prog = perf_dir / "x07" / f"{base}.x07.json"
+    project_file = perf_dir / "projects" / "regex" / "x07.json"
+    cc_style = "clang" if "clang" in _tool_identity("cc", "--version").lower() else "gcc"
+
+    results = []
+    for variant in build_variants:
+        spec = BUILD_VARIANTS[variant]
+        # (language, runner, binary, build(extra flags) -> ms, PGO style)
+        builds: list[tuple[str, Any, Path, Callable[[list[str]], float], str]] = []
+        pgo = variant == "pgo"
+        cache = None if pgo else opts.build_cache
+
+        if "c" in spec and c_prog.exists() and not _posix_regex_unsupported(benchmark):
+            for mode in _c_io_modes(c_io):
+                c_language, io_define = C_IO_VARIANTS[mode]
+                c_runner = CRunner(cache=cache)
+                binary = tmp_dir / f"{benchmark}_c_{mode}_{variant}"
+                builds.append((
+                    c_language, c_runner, binary,
+                    lambda extra, r=c_runner, b=binary, f=spec["c"], d=io_define: r.compile(
+                        c_prog, b, extra_flags=[f"-DBENCH_IO={d}"], opt_flags=f + extra
+                    ),
+                    cc_style,
+                ))
+
+        if "cargo" in spec and (cargo_proj / "Cargo.toml").exists():
+            cargo_runner = RustCargoRunner(cache=cache)
+            binary = tmp_dir / f"{benchmark}_rust_{variant}"
+            # Cargo puts this directory in LD_LIBRARY_PATH, so it must not
+            # contain the `:` of a `name:case` key.
+            target_dir = tmp_dir / f"rust_{variant}.target"
+
+            def cargo_build(extra: list[str], r=cargo_runner, b=binary, t=target_dir,
+                            env=spec["cargo"]) -> float:
+                build_env = dict(env, RUSTFLAGS=" ".join(extra)) if extra else env
+                return r.compile(cargo_proj, b, env=build_env, target_dir=t)
+
+            builds.append(("Rust", cargo_runner, binary, cargo_build, "rust"))
+        elif "rust" in spec and rust_prog.exists() and not (cargo_proj / "Cargo.toml").exists():
+            rust_runner = RustRunner(cache=cache)
+            binary = tmp_dir / f"{benchmark}_rust_{variant}"
+            builds.append((
+                "Rust", rust_runner, binary,
+                lambda extra, r=rust_runner, b=binary, f=spec["rust"]: r.compile(
+                    rust_prog, b, opt_flags=f + extra
+                ),
+                "rust",
+            ))
+
+        for language, runner, binary, build, style in builds:
+            result = BenchmarkResult(language=f"{language}-{variant}", benchmark=benchmark)
+            try:
+                if pgo:
+                    result.compile_time_ms = _pgo_build(
+                        build,
+                        lambda r=runner, b=binary: r.run(b, input_data.stdin),
+                        tmp_dir / f"{language.lower()}_{variant}.pgo",
+                        style,
+                    )
                 else:
-                    x07_runner.run_cached(artifact, input_data.data)
+                    result.compile_time_ms = build([])
+                reference_output = _measure_native(
+                    result, runner, binary, input_data, opts, reference_output
+                )
+            except Exception as e:
+                result.success = False
+                result.error = str(e)
+            results.append(result)
+
+        profile = spec.get("x07")
+        if profile and profile != x07_cc_profile:
+            result = BenchmarkResult(language=f"X07-{variant}", benchmark=benchmark)
+            artifact = tmp_dir / f"{benchmark}_x07_{variant}"
+            try:
+                if base in X07_PROJECT_ENTRIES and project_file.exists():
+                    x07_builder: Any = X07ProjectRunner(
+                        x07_host_runner, cc_profile=profile, cache=opts.build_cache
+                    )
+                    result.compile_time_ms = _compile_x07_project_entry(
+                        x07_builder, project_file, X07_PROJECT_ENTRIES[base], artifact
+                    )
+                elif x07_prog.exists():
+                    x07_builder = X07DirectRunner(
+                        x07_host_runner, cc_profile=profile, cache=opts.build_cache
+                    )
+                    result.compile_time_ms = x07_builder.compile(x07_prog, artifact)
+                else:
+                    continue
+                reference_output = _measure_x07(
+                    result, x07_builder, X07Runner(x07_host_runner, cc_profile=profile),
+                    artifact, input_data, opts, direct_mode, reference_output,
+                )
+            except Exception as e:
+                result.success = False
+                result.error = str(e)
+            results.append(result)
+
+    return results, reference_output
+
+
+# Alternative regex engines for the C regex programs (see c/regex_engine.h).
+# The POSIX engine is the default build and shows up as the plain "C" rows.
+C_REGEX_BACKENDS: dict[str, dict[str, Any]] = {
+    "pcre2": {
+        "language": "C-pcre2",
+        "define": "BENCH_REGEX_PCRE2",
+        "pkg_config": "libpcre2-8",
+        "libs": ["-lpcre2-8"],
+        "sources": [],
+    },
+    "re2": {
+        "language": "C-re2",
+        "define": "BENCH_REGEX_RE2",
+        "pkg_config": "re2",
+        "libs": ["-lre2"],
+        "sources": ["regex_engine_re2.cc"],
+    },
+}
+
+
+def _pkg_config(module: str, what: str) -> list[str] | None:
+    """Return `pkg-config --cflags/--libs` for a module, or None if unavailable."""
+    if shutil.which("pkg-config") is None:
+        return None
+    res = subprocess.run(["pkg-config", what, module], capture_output=True, text=True)
+    if res.returncode != 0:
+        return None
+    return res.stdout.split()
 
-            if direct_mode:
-                for _ in range(iterations):
-                    output, run_time = direct_runner.run_direct(artifact, input_data.data)
-                    result.times_ms.append(run_time)
-            else:
-                for _ in range(iterations):
-                    start = time.perf_counter()
-                    output, _metrics = x07_runner.run_cached(artifact, input_data.data)
-                    result.times_ms.append((time.perf_counter() - start) * 1000)
 
-            if reference_output is not None and output != reference_output:
-                result.error = "Output mismatch with reference"
+def _resolve_regex_backends(spec: str) -> list[str]:
+    """Parse --regex-backends; "auto" keeps the engines pkg-config can find."""
+    if spec == "auto":
+        return [
+            name
+            for name, backend in C_REGEX_BACKENDS.items()
+            if _pkg_config(backend["pkg_config"], "--libs") is not None
+        ]
+    names = [name.strip() for name in spec.split(",") if name.strip()]
+    return [name for name in names if name != "posix"]
+
+
+def _run_c_regex_backends(
+    benchmark: str,
+    backends: list[str],
+    c_prog: Path,
+    tmp_dir: Path,
+    input_data: InputData,
+    opts: MeasureOptions,
+    reference_output: bytes | None,
+) -> tuple[list[BenchmarkResult], bytes | None]:
+    """Build and run the C regex program once per alternative engine."""
+    c_runner = CRunner(cache=opts.build_cache)
+    results = []
+    for name in backends:
+        backend = C_REGEX_BACKENDS[name]
+        result = BenchmarkResult(language=backend["language"], benchmark=benchmark)
+        try:
+            cflags = _pkg_config(backend["pkg_config"], "--cflags") or []
+            libs = _pkg_config(backend["pkg_config"], "--libs") or backend["libs"]
+            binary = tmp_dir / f"{benchmark}_c_{name}"
+            result.compile_time_ms = c_runner.compile(
+                c_prog,
+                binary,
+                extra_flags=["-DBENCH_IO=BENCH_IO_MMAP", f"-DBENCH_REGEX={backend['define']}"]
+                + cflags,
+                extra_sources=[c_prog.parent / src for src in backend["sources"]],
+                link_flags=libs,
+            )
+            reference_output = _measure_native(
+                result, c_runner, binary, input_data, opts, reference_output, serve=True
+            )
 
         except Exception as e:
             result.success = False
@@ -887,27 +3339,302 @@ def run_benchmark(
 
         results.append(result)
 
-    if c_prog.exists():
-        result = BenchmarkResult(language="C", benchmark=benchmark)
+    return results, reference_output
+
+
+# Variant suffixes run whenever a `<benchmark>_<suffix>` source exists: the
+# zero-copy regex programs (c/regex_*_zc.c) report next to the copying ones,
+# and the table-driven word_count_table programs next to word_count.
+DEFAULT_VARIANTS = ("zc", "table")
+
+# Benchmarks built from projects/regex, by the project entry they select.
+X07_PROJECT_ENTRIES = {
+    "regex_is_match": "src/is_match.x07.json",
+    "regex_count": "src/count.x07.json",
+    "regex_replace": "src/replace.x07.json",
+    "pipeline": "src/pipeline.x07.json",
+}
+
+
+def _compile_x07_project_entry(
+    runner: X07ProjectRunner, project_file: Path, entry: str, artifact: Path
+) -> float:
+    """Build `entry` of the shared project, returning compile time in ms.
+
+    The entry point is selected by rewriting the project file, so concurrent
+    benchmarks (--jobs) take turns compiling it.
+    """
+    with _X07_PROJECT_LOCK:
+        original_project_text = project_file.read_text()
         try:
-            binary = tmp_dir / f"{benchmark}_c"
-            result.compile_time_ms = c_runner.compile(c_prog, binary)
-            result.build_size_bytes = binary.stat().st_size
+            project_data = json.loads(original_project_text)
+            project_data["entry"] = entry
+            project_file.write_text(json.dumps(project_data, indent=2))
+            return runner.compile(project_file, artifact)
+        finally:
+            project_file.write_text(original_project_text)
 
-            output, rss_kb = c_runner.run_with_rss(binary, input_data.data)
-            result.peak_rss_kb = rss_kb
-            result.output_bytes = output
-            if reference_output is not None and output != reference_output:
-                result.error = "Output mismatch with reference"
+# Build states timed by --compile-bench, in the order each iteration runs them.
+COMPILE_PHASES = ("cold", "noop", "edit")
 
-            for _ in range(warmup):
-                c_runner.run(binary, input_data.data)
 
-            for _ in range(iterations):
-                output, run_time = c_runner.run(binary, input_data.data)
-                result.times_ms.append(run_time)
+@dataclass
+class CompileBenchResult:
+    """X07 compile times for one program across the COMPILE_PHASES."""
+    program: str
+    kind: str  # "project" or "direct"
+    times_ms: dict[str, list[float]] = field(default_factory=dict)
+    error: str | None = None
+
+    def stats(self, phase: str) -> dict[str, float] | None:
+        times = self.times_ms.get(phase)
+        if not times:
+            return None
+        return {
+            "mean_ms": statistics.mean(times),
+            "min_ms": min(times),
+            "stddev_ms": statistics.stdev(times) if len(times) > 1 else 0.0,
+        }
+
+
+def _x07_edit_module(path: Path, nonce: int) -> None:
+    """Make a one-function edit to an X07 module: bind a fresh unused constant
+    at the top of its `solve` body (or of its first function with a body).
+
+    The result of the program does not change, but the module's bytes do, so
+    the toolchain has to rebuild it while its dependencies stay untouched.
+    """
+    module = json.loads(path.read_text())
+    stmt = ["let", "_x07_edit_nonce", nonce]
+    if "solve" in module:
+        holder, key = module, "solve"
+    else:
+        holder = next((d for d in module.get("decls", []) if "body" in d), None)
+        if holder is None:
+            raise RuntimeError(f"no function body to edit in {path}")
+        key = "body"
+    body = holder[key]
+    if isinstance(body, list) and body and body[0] == "begin":
+        body.insert(1, stmt)
+    else:
+        holder[key] = ["begin", stmt, body]
+    path.write_text(json.dumps(module, separators=(",", ":")))
+
+
+def _copy_project_tree(src: Path, dst: Path) -> None:
+    """Copy an X07 project without its build output.
+
+    Package links such as pkgs/ext-regex are relative symlinks into the
+    toolchain's package tree; they are re-pointed at the same absolute
+    target so the copy resolves the same dependency sources.
+    """
+    shutil.copytree(src, dst, symlinks=True, ignore=shutil.ignore_patterns("target", ".x07"))
+    for link in [p for p in dst.rglob("*") if p.is_symlink()]:
+        original = src / link.relative_to(dst)
+        target = Path(os.path.normpath(original.parent / os.readlink(original)))
+        link.unlink()
+        link.symlink_to(target, target_is_directory=target.is_dir())
+
+
+def run_compile_benchmark(
+    base: str,
+    x07_host_runner: Path,
+    perf_repo_root: Path,
+    tmp_dir: Path,
+    iterations: int = 5,
+    x07_cc_profile: str = "default",
+) -> CompileBenchResult | None:
+    """Time X07 builds of one benchmark program: cold, no-op and after an edit.
+
+    Each iteration copies the program (for the regex benchmarks, the whole
+    projects/regex tree with its packages) into a fresh directory, so the
+    cold build starts without any project-local build state. The same copy
+    is then rebuilt unchanged (no-op) and once more after _x07_edit_module
+    touches the entry module. The build cache is bypassed throughout.
+    Caches the toolchain keeps outside the project directory are not cleared.
+    Returns None when the benchmark has no X07 program.
+    """
+    project_file = perf_repo_root / "projects" / "regex" / "x07.json"
+    if base in X07_PROJECT_ENTRIES and project_file.exists():
+        kind = "project"
+        runner: Any = X07ProjectRunner(x07_host_runner, cc_profile=x07_cc_profile)
+    else:
+        kind = "direct"
+        runner = X07DirectRunner(x07_host_runner, cc_profile=x07_cc_profile)
+        program = perf_repo_root / "x07" / f"{base}.x07.json"
+        if not program.exists():
+            return None
+
+    result = CompileBenchResult(program=base, kind=kind)
+    result.times_ms = {phase: [] for phase in COMPILE_PHASES}
+    work_root = tmp_dir / f"compile_{base}"
+    try:
+        for i in range(iterations):
+            work = work_root / str(i)
+            shutil.rmtree(work, ignore_errors=True)
+            if kind == "project":
+                _copy_project_tree(project_file.parent, work)
+                target = work / "x07.json"
+                project_data = json.loads(target.read_text())
+                project_data["entry"] = X07_PROJECT_ENTRIES[base]
+                target.write_text(json.dumps(project_data, indent=2))
+                edited = work / X07_PROJECT_ENTRIES[base]
+            else:
+                work.mkdir(parents=True)
+                target = edited = work / program.name
+                shutil.copy2(program, target)
+
+            artifact = work / f"{base}_x07"
+            for phase in COMPILE_PHASES:
+                if phase == "edit":
+                    _x07_edit_module(edited, i + 1)
+                result.times_ms[phase].append(runner.compile(target, artifact))
+            shutil.rmtree(work, ignore_errors=True)
+    except Exception as e:
+        result.error = str(e)
+    return result
+
+
+# Stages of the `pipeline` benchmark, in order. Its primary programs
+# (c/pipeline.c, rust_cargo/pipeline, projects/regex/src/pipeline.x07.json)
+# run the same kernels fused in one process.
+PIPELINE_STAGES = ("regex_replace", "rle_encode", "byte_freq")
+
+
+def _feed(pipe: Any, data: bytes) -> None:
+    try:
+        pipe.write(data)
+    except BrokenPipeError:
+        pass
+    finally:
+        pipe.close()
+
+
+def _run_pipe(commands: list[list[str]], input_data: bytes | Path) -> tuple[bytes, float]:
+    """Run `commands` as `a | b | c`, returning the last stage's output and time in ms.
+
+    The stages are started directly, without a shell, so the time covers
+    their process starts, their work and the pipe traffic between them.
+    """
+    with _stdin(input_data) as stdin:
+        start = time.perf_counter()
+        procs: list[subprocess.Popen] = []
+        for i, cmd in enumerate(commands):
+            if i:
+                source: Any = procs[-1].stdout
+            else:
+                source = stdin.get("stdin", subprocess.PIPE)
+            procs.append(subprocess.Popen(
+                cmd, stdin=source, stdout=subprocess.PIPE, stderr=subprocess.DEVNULL
+            ))
+            if i:
+                # The next stage holds the read end now; closing ours lets an
+                # early exit downstream reach the writer as EPIPE.
+                procs[-2].stdout.close()
+        feeder = None
+        if "input" in stdin:
+            feeder = threading.Thread(target=_feed, args=(procs[0].stdin, stdin["input"]))
+            feeder.start()
+        output = procs[-1].stdout.read()
+        procs[-1].stdout.close()
+        codes = [p.wait() for p in procs]
+        if feeder is not None:
+            feeder.join()
+        run_time = (time.perf_counter() - start) * 1000
+
+    if any(codes):
+        raise RuntimeError(f"pipeline stage failed (exit codes {codes})")
+    return output, run_time
+
+
+def _run_pipeline_pipes(
+    perf_dir: Path,
+    tmp_dir: Path,
+    input_data: InputData,
+    opts: MeasureOptions,
+    reference_output: bytes | None,
+    x07_host_runner: Path,
+    x07_cc_profile: str,
+    direct_mode: bool,
+    c_io: str,
+) -> tuple[list[BenchmarkResult], bytes | None]:
+    """Run the PIPELINE_STAGES programs as separate processes joined by pipes.
+
+    Each language with every stage program gets a `<language>-pipe` row. The
+    plain `pipeline` rows are the fused programs, so the difference between
+    the two is the cost of the stage boundaries. X07 stages are direct
+    binaries, whose length-prefixed I/O composes through a pipe, so X07-pipe
+    needs --direct. Go has no regex_replace program and gets no row.
+    """
+    cache = opts.build_cache
+    rust_runner = RustRunner(cache=cache)
+    cargo_runner = RustCargoRunner(cache=cache)
+    x07_runner = X07DirectRunner(x07_host_runner, cc_profile=x07_cc_profile, cache=cache)
+    project_runner = X07ProjectRunner(x07_host_runner, cc_profile=x07_cc_profile, cache=cache)
+    project_file = perf_dir / "projects" / "regex" / "x07.json"
+
+    def c_stage(io_define: str) -> Callable[[str, Path], float]:
+        runner = CRunner(cache=cache)
+        return lambda stage, binary: runner.compile(
+            perf_dir / "c" / f"{stage}.c", binary, extra_flags=[f"-DBENCH_IO={io_define}"]
+        )
+
+    def rust_stage(stage: str, binary: Path) -> float:
+        if (perf_dir / "rust_cargo" / stage / "Cargo.toml").exists():
+            return cargo_runner.compile(perf_dir / "rust_cargo" / stage, binary)
+        return rust_runner.compile(perf_dir / "rust" / f"{stage}.rs", binary)
+
+    def x07_stage(stage: str, binary: Path) -> float:
+        if stage in X07_PROJECT_ENTRIES:
+            return _compile_x07_project_entry(
+                project_runner, project_file, X07_PROJECT_ENTRIES[stage], binary
+            )
+        return x07_runner.compile(perf_dir / "x07" / f"{stage}.x07.json", binary)
+
+    # (row label, stage builder, X07-framed I/O)
+    languages: list[tuple[str, Callable[[str, Path], float], bool]] = [
+        (C_IO_VARIANTS[mode][0], c_stage(C_IO_VARIANTS[mode][1]), False)
+        for mode in _c_io_modes(c_io)
+    ]
+    languages.append(("Rust", rust_stage, False))
+    if direct_mode:
+        languages.insert(0, ("X07", x07_stage, True))
+
+    results = []
+    for language, build, framed in languages:
+        label = f"{language}-pipe"
+        result = BenchmarkResult(language=label, benchmark="pipeline")
+        try:
+            binaries = []
+            for stage in PIPELINE_STAGES:
+                binary = tmp_dir / f"pipe_{stage}_{label.lower()}"
+                result.compile_time_ms += build(stage, binary)
+                binaries.append(binary)
+            result.build_size_bytes = sum(b.stat().st_size for b in binaries)
+            result.compile_cached = _compile_replayed(opts, *binaries)
+            commands = [[str(b)] for b in binaries]
+            stdin = _x07_framed(input_data.x07_stdin) if framed else input_data.stdin
+
+            def run_once() -> tuple[bytes, float]:
+                output, run_time = _run_pipe(commands, stdin)
+                return (_x07_unframed(output) if framed else output), run_time
+
+            with _pinned(opts.core):
+                for _ in range(opts.warmup):
+                    run_once()
+                output = b""
+
+                def timed_run() -> float:
+                    nonlocal output
+                    output, run_time = run_once()
+                    return run_time
+
+                result.times_ms = _sample_times(timed_run, opts)
             result.output_bytes = output
-            if reference_output is not None and output != reference_output:
+
+            if reference_output is None:
+                reference_output = output
+            elif output != reference_output:
                 result.error = "Output mismatch with reference"
 
         except Exception as e:
@@ -916,195 +3643,1616 @@ def run_benchmark(
 
         results.append(result)
 
-    # Priority: cargo-based Rust over single-file Rust
-    if rust_cargo_exists:
-        result = BenchmarkResult(language="Rust", benchmark=benchmark)
-        try:
-            cargo_runner = RustCargoRunner()
-            binary = tmp_dir / f"{benchmark}_rust"
+    return results, reference_output
 
-            result.compile_time_ms = cargo_runner.compile(rust_cargo_proj, binary)
-            result.build_size_bytes = binary.stat().st_size
 
-            output, rss_kb = cargo_runner.run_with_rss(binary, input_data.data)
-            result.peak_rss_kb = rss_kb
-            result.output_bytes = output
-            if reference_output is not None and output != reference_output:
-                result.error = "Output mismatch with reference"
+def run_benchmark(
+    benchmark: str,
+    input_data: InputData,
+    x07_host_runner: Path,
+    perf_repo_root: Path,
+    tmp_dir: Path,
+    iterations: int = 5,
+    warmup: int = 1,
+    direct_mode: bool = False,
+    x07_cc_profile: str = "default",
+    c_io: str = "both",
+    variants: list[str] | None = None,
+    threads: list[int] | None = None,
+    regex_backends: list[str] | None = None,
+    counters: bool = False,
+    kernel_timing: bool = False,
+    serve_requests: int = 0,
+    memory: bool = False,
+    launcher: Path | None = None,
+    core: int | None = None,
+    build_cache: BuildCache | None = None,
+    target_ci: float = 0.0,
+    time_budget_s: float = 10.0,
+    max_iterations: int = 200,
+    allocators: list[tuple[str, Path]] | None = None,
+    alloc_counter: Path | None = None,
+    build_variants: list[str] | None = None,
+    key: str | None = None,
+) -> list[BenchmarkResult]:
+    """Run a benchmark across all languages.
+
+    `variants` lists extra implementation suffixes (e.g. "stream") to run
+    alongside the primary programs; see _run_source_variants. `threads`
+    turns on the thread-count sweep over the `_par` variants.
+    `regex_backends` adds C rows for the regex benchmarks built with other
+    engines (see C_REGEX_BACKENDS). `counters` adds one perf-counter run
+    per row (see _run_with_counters). `kernel_timing` splits each row's
+    time into startup and kernel (see _run_kernel_timed). `serve_requests`
+    adds a server-mode latency run per harness program (see _measure_serve).
+    `memory` samples faults and RSS during the timed runs (see
+    _run_memory_sampled). `launcher` (the built tools/launcher.c) times
+    the runs in batches instead of from Python (see _launch_batch).
+    `core` pins every measured (not compiled) process to that CPU.
+    `build_cache` reuses binaries built by earlier runs (see BuildCache).
+    `target_ci`, `time_budget_s` and `max_iterations` control adaptive
+    sampling (see _sample_times). `allocators` adds rows re-run with each
+    (name, library) preloaded, and `alloc_counter` (the built
+    tools/alloc_count.c) fills in each row's allocation counts.
+    `build_variants` adds a row per BUILD_VARIANTS entry and language (see
+    _run_build_variants). `key` is the results key (`name@size` for sweep
+    points) and names the run's build directory, so concurrent points of
+    one benchmark (--jobs) do not replace each other's binaries.
+    """
+    results = []
+    opts = MeasureOptions(
+        warmup=warmup,
+        iterations=iterations,
+        counters=counters,
+        kernel_timing=kernel_timing,
+        serve_requests=serve_requests,
+        memory=memory,
+        launcher=launcher,
+        core=core,
+        build_cache=build_cache,
+        target_ci=target_ci,
+        time_budget_s=time_budget_s,
+        max_iterations=max_iterations,
+    )
 
-            for _ in range(warmup):
-                cargo_runner.run(binary, input_data.data)
+    # Programs are looked up by the base name; the full `name:case` key only
+    # selects the input and labels the results.
+    base, _case = _split_benchmark(benchmark)
+    skip_posix_c = _posix_regex_unsupported(benchmark)
+    # ':' would split the directory in LD_LIBRARY_PATH-style lists.
+    tmp_dir = tmp_dir / (key or benchmark).replace(":", "_")
+    tmp_dir.mkdir(parents=True, exist_ok=True)
 
-            for _ in range(iterations):
-                output, run_time = cargo_runner.run(binary, input_data.data)
-                result.times_ms.append(run_time)
+    perf_dir = perf_repo_root
+    c_runner = CRunner(cache=build_cache)
+    rust_runner = RustRunner(cache=build_cache)
+    go_runner = GoRunner(cache=build_cache)
 
-        except Exception as e:
-            result.success = False
-            result.error = str(e)
+    x07_prog = perf_dir / "x07" / f"{base}.x07.json"
+    c_prog = perf_dir / "c" / f"{base}.c"
+    rust_prog = perf_dir / "rust" / f"{base}.rs"
+    go_prog = perf_dir / "go" / f"{base}.go"
 
-        results.append(result)
+    # Check for project-based X07 (e.g., regex benchmarks)
+    x07_project = None
+    if base in X07_PROJECT_ENTRIES:
+        project_file = perf_dir / "projects" / "regex" / "x07.json"
+        if project_file.exists():
+            x07_project = (project_file, X07_PROJECT_ENTRIES[base])
 
-    elif rust_prog.exists():
+    # Check for cargo-based Rust (e.g., regex benchmarks)
+    rust_cargo_proj = perf_dir / "rust_cargo" / base
+    rust_cargo_exists = (rust_cargo_proj / "Cargo.toml").exists()
+
+    reference_output = None
+    # (row, binary, X07-framed I/O) for the dynamically linked programs that
+    # --allocators / --alloc-count re-run with a library preloaded. Go is
+    # left out: its binaries are static and do not use malloc.
+    preload_targets: list[tuple[BenchmarkResult, Path, bool]] = []
+
+    # Priority: project-based X07 over single-file X07
+    if x07_project is not None:
+        project_file, entry = x07_project
+        result = BenchmarkResult(language="X07", benchmark=benchmark)
+        try:
+            x07_runner = X07Runner(x07_host_runner, cc_profile=x07_cc_profile)
+            project_runner = X07ProjectRunner(
+                x07_host_runner, cc_profile=x07_cc_profile, cache=build_cache
+            )
+            artifact = tmp_dir / f"{benchmark}_x07"
+            result.compile_time_ms = _compile_x07_project_entry(
+                project_runner, project_file, entry, artifact
+            )
+
+            reference_output = _measure_x07(
+                result, project_runner, x07_runner, artifact, input_data, opts, direct_mode,
+                reference_output,
+            )
+            preload_targets.append((result, artifact, True))
+
+        except Exception as e:
+            result.success = False
+            result.error = str(e)
+
+        results.append(result)
+
+    elif x07_prog.exists():
+        result = BenchmarkResult(language="X07", benchmark=benchmark)
+        try:
+            x07_runner = X07Runner(x07_host_runner, cc_profile=x07_cc_profile)
+            direct_runner = X07DirectRunner(
+                x07_host_runner, cc_profile=x07_cc_profile, cache=build_cache
+            )
+            artifact = tmp_dir / f"{benchmark}_x07"
+
+            result.compile_time_ms = direct_runner.compile(x07_prog, artifact)
+            reference_output = _measure_x07(
+                result, direct_runner, x07_runner, artifact, input_data, opts, direct_mode,
+                reference_output,
+            )
+            preload_targets.append((result, artifact, True))
+
+        except Exception as e:
+            result.success = False
+            result.error = str(e)
+
+        results.append(result)
+
+    if c_prog.exists():
+        for mode in [] if skip_posix_c else _c_io_modes(c_io):
+            language, io_define = C_IO_VARIANTS[mode]
+            result = BenchmarkResult(language=language, benchmark=benchmark)
+            try:
+                binary = tmp_dir / f"{benchmark}_c_{mode}"
+                result.compile_time_ms = c_runner.compile(
+                    c_prog, binary, extra_flags=[f"-DBENCH_IO={io_define}"]
+                )
+                reference_output = _measure_native(
+                    result, c_runner, binary, input_data, opts, reference_output, serve=True
+                )
+                preload_targets.append((result, binary, False))
+
+            except Exception as e:
+                result.success = False
+                result.error = str(e)
+
+            results.append(result)
+
+        if base.startswith("regex_") and regex_backends:
+            backend_results, reference_output = _run_c_regex_backends(
+                base,
+                regex_backends,
+                c_prog,
+                tmp_dir,
+                input_data,
+                opts,
+                reference_output,
+            )
+            results.extend(backend_results)
+
+    # Priority: cargo-based Rust over single-file Rust
+    if rust_cargo_exists:
+        result = BenchmarkResult(language="Rust", benchmark=benchmark)
+        try:
+            cargo_runner = RustCargoRunner(cache=build_cache)
+            binary = tmp_dir / f"{benchmark}_rust"
+
+            result.compile_time_ms = cargo_runner.compile(rust_cargo_proj, binary)
+            reference_output = _measure_native(
+                result, cargo_runner, binary, input_data, opts, reference_output, serve=True
+            )
+            preload_targets.append((result, binary, False))
+
+        except Exception as e:
+            result.success = False
+            result.error = str(e)
+
+        results.append(result)
+
+    elif rust_prog.exists():
         result = BenchmarkResult(language="Rust", benchmark=benchmark)
         try:
             binary = tmp_dir / f"{benchmark}_rust"
             result.compile_time_ms = rust_runner.compile(rust_prog, binary)
-            result.build_size_bytes = binary.stat().st_size
+            reference_output = _measure_native(
+                result, rust_runner, binary, input_data, opts, reference_output, serve=True
+            )
+            preload_targets.append((result, binary, False))
 
-            output, rss_kb = rust_runner.run_with_rss(binary, input_data.data)
-            result.peak_rss_kb = rss_kb
-            result.output_bytes = output
-            if reference_output is not None and output != reference_output:
-                result.error = "Output mismatch with reference"
+        except Exception as e:
+            result.success = False
+            result.error = str(e)
+
+        results.append(result)
+
+    if go_prog.exists():
+        result = BenchmarkResult(language="Go", benchmark=benchmark)
+        try:
+            binary = tmp_dir / f"{benchmark}_go"
+            result.compile_time_ms = go_runner.compile(go_prog, binary)
+            reference_output = _measure_native(
+                result, go_runner, binary, input_data, opts, reference_output, serve=True
+            )
+
+        except Exception as e:
+            result.success = False
+            result.error = str(e)
+
+        results.append(result)
+
+    if build_variants:
+        variant_rows, reference_output = _run_build_variants(
+            benchmark,
+            build_variants,
+            perf_dir,
+            tmp_dir,
+            input_data,
+            opts,
+            reference_output,
+            x07_host_runner,
+            x07_cc_profile,
+            direct_mode,
+            c_io,
+        )
+        results.extend(variant_rows)
+
+    if base == "pipeline":
+        pipe_results, reference_output = _run_pipeline_pipes(
+            perf_dir,
+            tmp_dir,
+            input_data,
+            opts,
+            reference_output,
+            x07_host_runner,
+            x07_cc_profile,
+            direct_mode,
+            c_io,
+        )
+        results.extend(pipe_results)
+
+    for suffix in list(variants or []) + [v for v in DEFAULT_VARIANTS if v not in (variants or [])]:
+        variant_results, reference_output = _run_source_variants(
+            base,
+            suffix,
+            perf_dir,
+            tmp_dir,
+            input_data,
+            opts,
+            reference_output,
+            skip_c=skip_posix_c,
+        )
+        results.extend(variant_results)
+        variant_results, reference_output = _run_x07_source_variant(
+            base, suffix, perf_dir, tmp_dir, input_data, opts, reference_output,
+            x07_host_runner, x07_cc_profile, direct_mode,
+        )
+        results.extend(variant_results)
+
+    if threads:
+        par_results, reference_output = _run_source_variants(
+            base,
+            "par",
+            perf_dir,
+            tmp_dir,
+            input_data,
+            # Thread-scaling rows need more than the one pinned core.
+            replace(opts, core=None),
+            reference_output,
+            threads=threads,
+        )
+        results.extend(par_results)
+
+    if alloc_counter is not None:
+        for row, binary, framed in preload_targets:
+            try:
+                row.allocations = _count_allocations(
+                    binary, input_data.x07_stdin if framed else input_data.stdin,
+                    alloc_counter, framed,
+                )
+            except Exception as e:
+                print(f"warning: --alloc-count failed for {row.language}: {e}", file=sys.stderr)
+
+    for name, lib in allocators or []:
+        alloc_results, reference_output = _run_allocator_variants(
+            name, lib, preload_targets, input_data, opts, reference_output
+        )
+        results.extend(alloc_results)
+
+    # Unpinned runs may land on any CPU, so no one governor describes them.
+    governor = cpu_governor(core) if core is not None else ""
+    processed_bytes = _processed_bytes(benchmark, input_data.data)
+    for r in results:
+        r.benchmark = benchmark
+        r.input_bytes = len(input_data.data)
+        r.processed_bytes = processed_bytes
+        r.core = None if r.threads else core
+        r.cpu_governor = governor if r.core is not None else ""
+
+    return results
+
+
+def print_results(
+    all_results: dict[str, list[BenchmarkResult]],
+    input_size: str,
+    direct_mode: bool = False,
+    x07_cc_profile: str = "default",
+) -> None:
+    """Print benchmark results in a formatted table."""
+    print()
+    print("=" * 80)
+    mode_str = "direct binary" if direct_mode else "host runner"
+    print(
+        f"Performance Benchmark Results (input size: {input_size}, X07 mode: {mode_str}, cc-profile: {x07_cc_profile})"
+    )
+    print("=" * 80)
+    print()
+
+    for benchmark, results in all_results.items():
+        print(f"Benchmark: {benchmark}")
+        print("-" * 80)
+        print(
+            f"{'Language':<12} {'Mean (ms)':<12} {'Min (ms)':<12} {'StdDev':<10} {'MB/s':<10} "
+            f"{'Compile (ms)':<12} {'Build (KiB)':<12} {'RSS (KiB)':<10} {'Status'}"
+        )
+        print("-" * 80)
+
+        x07 = _x07_row(results)
+        x07_time = x07.mean_time_ms if x07 else None
+
+        for r in results:
+            status = "OK" if r.success else f"FAIL: {r.error[:30]}"
+            if r.error and r.success:
+                status = f"WARN: {r.error[:25]}"
+
+            speedup = ""
+            if x07_time and r.success and r.mean_time_ms > 0:
+                ratio = x07_time / r.mean_time_ms
+                if r.language != "X07":
+                    speedup = f" ({ratio:.2f}x{_significance_mark(x07, r)})"
+
+            build_kib = r.build_size_bytes / 1024 if r.build_size_bytes else 0.0
+            compile_ms = f"{r.compile_time_ms:.1f}" + ("*" if r.compile_cached else "")
+            print(
+                f"{r.language:<12} "
+                f"{r.mean_time_ms:<12.2f} "
+                f"{r.min_time_ms:<12.2f} "
+                f"{r.stddev_time_ms:<10.2f} "
+                f"{r.throughput_mb_s:<10.1f} "
+                f"{compile_ms:<12} "
+                f"{build_kib:<12.1f} "
+                f"{'-' if r.peak_rss_kb is None else r.peak_rss_kb:<10} "
+                f"{status}{speedup}"
+            )
+
+        print()
+
+    print()
+    print("Legend:")
+    print("  - Mean/Min/StdDev: Execution time statistics over multiple runs")
+    print("  - MB/s: Input bytes (decoded bytes for rle_decode) per second of mean run time")
+    print("  - Compile: One-time compilation overhead (* = recorded when the build cache entry "
+          "was made; --fresh-compile re-times it)")
+    print("  - Build: Final executable size")
+    print("  - RSS: Peak resident set size (one run; - = exited before it was sampled)")
+    print("  - Speedup (Nx): How many times faster than X07")
+    print(f"  - ~: Not significantly different from X07 (Mann-Whitney p >= {SIGNIFICANCE_ALPHA})")
+    print()
+
+
+def _x07_row(results: list[BenchmarkResult]) -> BenchmarkResult | None:
+    return next((r for r in results if r.language == "X07" and r.success), None)
+
+
+def _significance_mark(x07: BenchmarkResult | None, r: BenchmarkResult) -> str:
+    """"~" when `r`'s run times are not significantly different from X07's."""
+    if x07 is None or r is x07 or not r.times_ms:
+        return ""
+    return "~" if x07.p_value_vs(r) >= SIGNIFICANCE_ALPHA else ""
+
+
+def print_stats_table(all_results: dict[str, list[BenchmarkResult]]) -> None:
+    """Print medians with bootstrap CIs and the significance of each X07 comparison."""
+    print()
+    print("=" * 80)
+    print("Statistics (median of runs after outlier rejection, bootstrap 95% CI)")
+    print("=" * 80)
+    print()
+    print(
+        f"{'Benchmark':<26} {'Language':<12} {'Runs':<6} {'Out':<4} {'Median (ms)':<12} "
+        f"{'95% CI (ms)':<20} {'vs X07':<9} {'p'}"
+    )
+    print("-" * 98)
+    for benchmark, results in all_results.items():
+        x07 = _x07_row(results)
+        for r in results:
+            if not r.success or not r.times_ms:
+                continue
+            lo, hi = r.ci95_ms
+            ratio = p = ""
+            if x07 is not None and r is not x07 and r.median_time_ms > 0:
+                ratio = f"{x07.median_time_ms / r.median_time_ms:.2f}x{_significance_mark(x07, r)}"
+                p = f"{x07.p_value_vs(r):.3g}"
+            print(
+                f"{benchmark:<26} {r.language:<12} {len(r.times_ms):<6} {r.outliers:<4} "
+                f"{r.median_time_ms:<12.3f} {f'[{lo:.3f}, {hi:.3f}]':<20} {ratio:<9} {p}"
+            )
+    print()
+
+
+def print_summary_table(all_results: dict[str, list[BenchmarkResult]]) -> None:
+    """Print a summary comparison table."""
+    print()
+    print("=" * 60)
+    print("Summary: Relative Performance (X07 = 1.0x)")
+    print("=" * 60)
+    print()
+    languages: list[str] = []
+    for results in all_results.values():
+        for r in results:
+            if r.language not in languages:
+                languages.append(r.language)
+    if "X07" not in languages:
+        languages.insert(0, "X07")
+
+    print(f"{'Benchmark':<28} " + " ".join(f"{lang:<12}" for lang in languages))
+    print("-" * (29 + 13 * len(languages)))
+
+    for benchmark, results in all_results.items():
+        row = {lang: "N/A" for lang in languages}
+        row["X07"] = "1.0x"
+
+        x07 = _x07_row(results)
+        x07_time = x07.mean_time_ms if x07 else None
+
+        if x07_time and x07_time > 0:
+            for r in results:
+                if r.success and r.mean_time_ms > 0:
+                    ratio = x07_time / r.mean_time_ms
+                    row[r.language] = f"{ratio:.2f}x{_significance_mark(x07, r)}"
+
+        print(f"{benchmark:<28} " + " ".join(f"{row[lang]:<12}" for lang in languages))
+
+    print()
+
+
+def print_scaling_table(all_results: dict[str, list[BenchmarkResult]]) -> None:
+    """Print speedup and parallel efficiency for the --threads sweep.
+
+    Speedup is relative to the same binary at one thread when the sweep
+    includes 1, otherwise to the language's primary single-threaded row.
+    """
+    rows = [
+        (benchmark, r)
+        for benchmark, results in all_results.items()
+        for r in results
+        if r.threads
+    ]
+    if not rows:
+        return
+
+    print()
+    print("=" * 70)
+    print("Thread Scaling (speedup = T(base) / T(n), efficiency = speedup / n)")
+    print("=" * 70)
+    print()
+    print(
+        f"{'Benchmark':<20} {'Language':<14} {'Threads':<8} {'Mean (ms)':<12} "
+        f"{'Speedup':<10} {'Efficiency'}"
+    )
+    print("-" * 70)
+
+    for benchmark, results in all_results.items():
+        by_label: dict[str, list[BenchmarkResult]] = {}
+        for r in results:
+            if r.threads:
+                by_label.setdefault(r.language.rsplit("/", 1)[0], []).append(r)
+
+        for label, group in by_label.items():
+            base_ms = 0.0
+            for r in group:
+                if r.threads == 1 and r.success:
+                    base_ms = r.mean_time_ms
+            if not base_ms:
+                serial = label.split("-", 1)[0]
+                for r in results:
+                    if r.language in (serial, f"{serial}-io") and r.success:
+                        base_ms = r.mean_time_ms
+
+            for r in group:
+                if not r.success or r.mean_time_ms <= 0:
+                    print(f"{benchmark:<20} {label:<14} {r.threads:<8} FAIL: {r.error[:30]}")
+                    continue
+                speedup = base_ms / r.mean_time_ms if base_ms else 0.0
+                efficiency = speedup / r.threads if speedup else 0.0
+                print(
+                    f"{benchmark:<20} {label:<14} {r.threads:<8} {r.mean_time_ms:<12.2f} "
+                    f"{speedup:<10.2f} {efficiency * 100:.0f}%"
+                )
+
+    print()
+
+
+def print_kernel_table(all_results: dict[str, list[BenchmarkResult]]) -> None:
+    """Print the --kernel-timing split of each row's mean time."""
+    if not any(
+        r.kernel_times_ms or r.startup_times_ms for results in all_results.values() for r in results
+    ):
+        return
+
+    print()
+    print("=" * 90)
+    print("Startup vs Kernel (startup = everything outside the kernel: exec, init, I/O)")
+    print("=" * 90)
+    print()
+    print(
+        f"{'Benchmark':<28} {'Language':<12} {'Wall (ms)':<10} {'Startup':<10} "
+        f"{'Kernel':<10} {'Kernel MB/s':<12} {'Source'}"
+    )
+    print("-" * 90)
+
+    for benchmark, results in all_results.items():
+        for r in results:
+            if not r.success:
+                continue
+            if r.kernel_times_ms:
+                source = "in-process"
+            elif r.startup_times_ms:
+                source = "empty-input estimate"
+            else:
+                print(f"{benchmark:<28} {r.language:<12} {r.mean_time_ms:<10.2f} -          -")
+                continue
+            print(
+                f"{benchmark:<28} {r.language:<12} {r.mean_time_ms:<10.2f} "
+                f"{r.startup_time_ms:<10.3f} {r.kernel_time_ms:<10.3f} "
+                f"{r.kernel_throughput_mb_s:<12.1f} {source}"
+            )
+
+    print()
+    print("in-process: startup includes reading the input and writing the output.")
+    print("empty-input estimate (X07): startup is a run on an empty input, so the kernel")
+    print("still includes reading the input and writing the output. Kernel and Kernel MB/s")
+    print("are therefore not comparable between these two sources.")
+    print()
+
+
+def print_host_table(all_results: dict[str, list[BenchmarkResult]]) -> None:
+    """Print where x07-host-runner spends each run, against the direct binary."""
+    rows = [
+        (benchmark, r)
+        for benchmark, results in all_results.items()
+        for r in results
+        if r.success and r.direct_times_ms
+    ]
+    if not rows:
+        return
+
+    # Median of each duration field per row; the columns are every field
+    # any row reported, in report order.
+    medians: list[dict[str, float]] = []
+    for _, r in rows:
+        runs = [_report_durations_ms(numbers) for numbers in r.host_reports]
+        names = dict.fromkeys(name for run in runs for name in run)
+        medians.append({
+            name: statistics.median([run[name] for run in runs if name in run]) for name in names
+        })
+    phases = list(dict.fromkeys(name for m in medians for name in m))
+    if not phases:
+        print(
+            "warning: x07-host-runner reports have no duration fields "
+            f"({', '.join('*' + u for u in _DURATION_UNITS)}); showing host vs direct only",
+            file=sys.stderr,
+        )
+    widths = [max(len(p) + 2, 10) for p in phases]
+
+    print()
+    print("=" * 110)
+    print("X07 host runner vs direct binary (median ms; - = not reported by x07-host-runner)")
+    print("=" * 110)
+    print()
+    phase_heads = "".join(f"{p:<{w}}" for p, w in zip(phases, widths))
+    print(f"{'Benchmark':<24} {'Host':<9} {'Direct':<9} {'Overhead':<9} {phase_heads}{'Other'}")
+    print("-" * 110)
+
+    for (benchmark, r), m in zip(rows, medians):
+        host = r.median_time_ms
+        direct = statistics.median(r.direct_times_ms)
+        cells = "".join(
+            f"{m[p]:<{w}.3f}" if p in m else f"{'-':<{w}}" for p, w in zip(phases, widths)
+        )
+        # More than the host time means some fields overlap (e.g. a total
+        # next to its phases), so the remainder is unknown.
+        other = host - sum(m.values())
+        other_cell = f"{other:.3f}" if other >= 0 else "-"
+        print(
+            f"{benchmark:<24} {host:<9.3f} {direct:<9.3f} {host - direct:<9.3f} {cells}{other_cell}"
+        )
+
+    print()
+    print("Phases are the report's *_ms/_us/_ns fields under their own names, in ms.")
+    print("Other is host time outside them (process start, JSON and base64 output),")
+    print("assuming the fields do not overlap; - when they add up to more than the host time.")
+    print()
+
+
+def print_pipeline_table(all_results: dict[str, list[BenchmarkResult]]) -> None:
+    """Print each fused pipeline row against its `-pipe` row (see _run_pipeline_pipes)."""
+    pairs = []
+    for benchmark, results in all_results.items():
+        by_language = {r.language: r for r in results if r.success and r.times_ms}
+        for r in results:
+            fused = by_language.get(r.language.removesuffix("-pipe"))
+            if r.language.endswith("-pipe") and r.language in by_language and fused:
+                pairs.append((benchmark, fused, r))
+    if not pairs:
+        return
+
+    print()
+    print("=" * 90)
+    print("Pipeline: fused program vs stages joined by pipes (median ms; boundary = pipe - fused)")
+    print("=" * 90)
+    print()
+    print(
+        f"{'Benchmark':<28} {'Language':<12} {'Fused':<10} {'Pipe':<10} {'Boundary':<10} "
+        f"{'Share':<8} {'Fused MB/s':<12} {'Pipe MB/s'}"
+    )
+    print("-" * 90)
+
+    for benchmark, fused, pipe in pairs:
+        boundary = pipe.median_time_ms - fused.median_time_ms
+        share = boundary / pipe.median_time_ms * 100 if pipe.median_time_ms > 0 else 0.0
+        print(
+            f"{benchmark:<28} {fused.language:<12} {fused.median_time_ms:<10.3f} "
+            f"{pipe.median_time_ms:<10.3f} {boundary:<10.3f} {f'{share:.1f}%':<8} "
+            f"{fused.throughput_mb_s:<12.1f} {pipe.throughput_mb_s:.1f}"
+        )
+
+    print()
+
+
+def print_serve_table(all_results: dict[str, list[BenchmarkResult]]) -> None:
+    """Print per-request latency percentiles from the --serve runs."""
+    if not any(r.serve for results in all_results.values() for r in results):
+        return
+
+    print()
+    print("=" * 90)
+    print("Server Mode (one process, requests sent back to back; latency in microseconds)")
+    print("=" * 90)
+    print()
+    print(
+        f"{'Benchmark':<28} {'Language':<12} {'p50':<10} {'p99':<10} {'p99.9':<10} "
+        f"{'Mean':<10} {'Req/s'}"
+    )
+    print("-" * 90)
+
+    for benchmark, results in all_results.items():
+        for r in results:
+            if not r.serve:
+                continue
+            sv = r.serve
+            print(
+                f"{benchmark:<28} {r.language:<12} {sv['p50_us']:<10.1f} {sv['p99_us']:<10.1f} "
+                f"{sv['p999_us']:<10.1f} {sv['mean_us']:<10.1f} {sv['requests_per_s']:.0f}"
+            )
+
+    print()
+
+
+def print_counters_table(all_results: dict[str, list[BenchmarkResult]]) -> None:
+    """Print the --counters run of each row: IPC, LLC and branch misses, faults."""
+    if not any(r.counters for results in all_results.values() for r in results):
+        return
+
+    print()
+    print("=" * 90)
+    print("Hardware Counters (one extra run per row; '-' = not reported on this host)")
+    print("=" * 90)
+    print()
+    print(
+        f"{'Benchmark':<28} {'Language':<12} {'Instr':<12} {'IPC':<6} "
+        f"{'LLC miss':<10} {'LLC %':<7} {'Br miss %':<10} {'Faults'}"
+    )
+    print("-" * 90)
+
+    def fmt(counters: dict[str, float], key: str, scale: float = 1.0, spec: str = ".0f") -> str:
+        return format(counters[key] * scale, spec) if key in counters else "-"
+
+    for benchmark, results in all_results.items():
+        for r in results:
+            if not r.counters:
+                continue
+            c = r.counters
+            print(
+                f"{benchmark:<28} {r.language:<12} "
+                f"{fmt(c, 'instructions'):<12} "
+                f"{fmt(c, 'ipc', spec='.2f'):<6} "
+                f"{fmt(c, 'llc_load_misses'):<10} "
+                f"{fmt(c, 'llc_miss_rate', 100, '.1f'):<7} "
+                f"{fmt(c, 'branch_miss_rate', 100, '.2f'):<10} "
+                f"{fmt(c, 'page_faults')}"
+            )
+
+    print()
+
+
+def print_alloc_table(all_results: dict[str, list[BenchmarkResult]]) -> None:
+    """Print the --alloc-count run of each row."""
+    if not any(r.allocations for results in all_results.values() for r in results):
+        return
+
+    print()
+    print("=" * 96)
+    print("Allocations (one run under tools/alloc_count.c; moves = reallocs that copied)")
+    print("=" * 96)
+    print()
+    print(
+        f"{'Benchmark':<28} {'Language':<10} {'Mallocs':<9} {'Frees':<9} {'Reallocs':<9} "
+        f"{'Moves':<7} {'Copied KiB':<11} {'Alloc KiB':<10} {'Peak KiB'}"
+    )
+    print("-" * 96)
+    for benchmark, results in all_results.items():
+        for r in results:
+            a = r.allocations
+            if not a:
+                continue
+            print(
+                f"{benchmark:<28} {r.language:<10} {a.get('mallocs', 0):<9} {a.get('frees', 0):<9} "
+                f"{a.get('reallocs', 0):<9} {a.get('realloc_moves', 0):<7} "
+                f"{a.get('realloc_copy_bytes', 0) / 1024:<11.1f} {a.get('bytes', 0) / 1024:<10.1f} "
+                f"{a.get('peak_bytes', 0) / 1024:.1f}"
+            )
+    print()
+
+
+def print_memory_table(all_results: dict[str, list[BenchmarkResult]]) -> None:
+    """Print the --memory profile of each row's timed runs."""
+    if not any(r.memory_runs for results in all_results.values() for r in results):
+        return
+
+    print()
+    print("=" * 110)
+    print("Memory (timed runs; faults are medians, peaks are maxima; KiB)")
+    print("=" * 110)
+    print()
+    print(
+        f"{'Benchmark':<28} {'Language':<10} {'Max RSS':<9} {'Anon':<9} {'File':<9} {'Heap':<9} "
+        f"{'Minor flt':<10} {'Major flt':<10} {'Peak at ms':<11} {'Samples'}"
+    )
+    print("-" * 110)
+
+    def peak(runs: list[dict[str, Any]], key: str) -> str:
+        vals = [m[key] for m in runs if m.get(key) is not None]
+        return str(max(vals)) if vals else "-"
+
+    for benchmark, results in all_results.items():
+        for r in results:
+            runs = r.memory_runs
+            if not runs:
+                continue
+            heap = r.allocations.get("peak_bytes")
+            timeline = r.rss_timeline_kb
+            peak_at = f"{max(timeline, key=lambda s: s[1])[0]:.1f}" if timeline else "-"
+            print(
+                f"{benchmark:<28} {r.language:<10} {peak(runs, 'max_rss_kb'):<9} "
+                f"{peak(runs, 'peak_anon_kb'):<9} {peak(runs, 'peak_file_kb'):<9} "
+                f"{(str(heap // 1024) if heap is not None else '-'):<9} "
+                f"{statistics.median(m['minor_faults'] for m in runs):<10.0f} "
+                f"{statistics.median(m['major_faults'] for m in runs):<10.0f} "
+                f"{peak_at:<11} {len(timeline)}"
+            )
+
+    print()
+    print("Anon and File are the largest RssAnon/RssFile samples; Heap is --alloc-count's peak live heap.")
+    print("The timeline in the JSON (rss_timeline_kb) is the last timed run.")
+    print()
+
+
+def _fit_sweep(points: list[tuple[int, float]]) -> dict[str, Any]:
+    """Least-squares fit of mean time = startup + per_byte * bytes over sweep points.
+
+    Also reports the marginal throughput between consecutive sizes, and
+    flags as knees the sizes where it falls by more than 30% from the
+    previous interval: the per-byte cost jumped, typically because the
+    working set left a cache level.
+    """
+    points = sorted(points)
+    fit: dict[str, Any] = {"startup_ms": None, "ns_per_byte": None, "asymptotic_gb_s": None,
+                           "r2": None, "marginal_gb_s": [], "knees": []}
+    if len(points) < 2:
+        return fit
+
+    xs = [float(x) for x, _ in points]
+    ys = [y for _, y in points]
+    mean_x = statistics.mean(xs)
+    mean_y = statistics.mean(ys)
+    sxx = sum((x - mean_x) ** 2 for x in xs)
+    sxy = sum((x - mean_x) * (y - mean_y) for x, y in zip(xs, ys))
+    slope = sxy / sxx if sxx else 0.0
+    intercept = mean_y - slope * mean_x
+    ss_tot = sum((y - mean_y) ** 2 for y in ys)
+    ss_res = sum((y - (intercept + slope * x)) ** 2 for x, y in zip(xs, ys))
+
+    fit["startup_ms"] = intercept
+    fit["ns_per_byte"] = slope * 1e6
+    fit["asymptotic_gb_s"] = 1 / (slope * 1e6) if slope > 0 else None
+    fit["r2"] = 1 - ss_res / ss_tot if ss_tot else None
+
+    prev = None
+    for (x0, y0), (x1, y1) in zip(points, points[1:]):
+        # bytes per ms / 1e6 = GB/s
+        marginal = (x1 - x0) / (y1 - y0) / 1e6 if y1 > y0 else None
+        fit["marginal_gb_s"].append(marginal)
+        if prev and marginal and marginal < 0.7 * prev:
+            fit["knees"].append(x1)
+        prev = marginal
+    return fit
+
+
+def sweep_fits(all_results: dict[str, list[BenchmarkResult]]) -> dict[str, dict[str, Any]]:
+    """Group `name@size` sweep results per benchmark and language and fit each curve."""
+    points: dict[str, dict[str, list[tuple[int, float]]]] = {}
+    for results in all_results.values():
+        for r in results:
+            if r.success and r.mean_time_ms > 0 and r.processed_bytes:
+                by_lang = points.setdefault(r.benchmark, {})
+                by_lang.setdefault(r.language, []).append((r.processed_bytes, r.mean_time_ms))
+
+    fits: dict[str, dict[str, Any]] = {}
+    for benchmark, by_lang in points.items():
+        fits[benchmark] = {}
+        for language, pts in by_lang.items():
+            fit = _fit_sweep(pts)
+            fit["sizes"] = [x for x, _ in sorted(pts)]
+            fit["gb_s"] = [x / (y / 1000) / 1e9 for x, y in sorted(pts)]
+            fits[benchmark][language] = fit
+    return fits
+
+
+def print_sweep_table(fits: dict[str, dict[str, Any]]) -> None:
+    """Print throughput per sweep point and the startup-plus-per-byte fit."""
+    if not fits:
+        return
+
+    print()
+    print("=" * 80)
+    print("Size Sweep (GB/s of mean wall time; marginal = d(bytes)/d(time); * = knee)")
+    print("=" * 80)
+
+    for benchmark, by_lang in fits.items():
+        for language, fit in by_lang.items():
+            print()
+            header = f"{benchmark} / {language}"
+            if fit["ns_per_byte"] is not None:
+                asym = fit["asymptotic_gb_s"]
+                header += (
+                    f": startup {fit['startup_ms']:.3f} ms, {fit['ns_per_byte']:.4f} ns/byte"
+                    + (f" ({asym:.2f} GB/s)" if asym else "")
+                    + (f", r2 {fit['r2']:.3f}" if fit["r2"] is not None else "")
+                )
+            print(header)
+            print(f"  {'Size':<8} {'GB/s':<10} {'Marginal GB/s'}")
+            marginals = [None] + fit["marginal_gb_s"]
+            for size, gbs, marginal in zip(fit["sizes"], fit["gb_s"], marginals):
+                knee = " *" if size in fit["knees"] else ""
+                m = f"{marginal:.2f}" if marginal else "-"
+                print(f"  {_format_size_kb(size // 1024):<8} {gbs:<10.3f} {m}{knee}")
+
+    print()
+
+
+def print_compile_table(results: list[CompileBenchResult], x07_cc_profile: str) -> None:
+    """Print X07 compile times per build phase, relative to the cold build."""
+    print()
+    print("=" * 80)
+    print(f"X07 Compile Times (cc-profile: {x07_cc_profile})")
+    print("=" * 80)
+    print(
+        f"{'Program':<18} {'Kind':<8} {'Phase':<6} {'Mean (ms)':<12} {'Min (ms)':<12} "
+        f"{'Stddev':<10} {'vs cold'}"
+    )
+    print("-" * 80)
+    for r in results:
+        if r.error:
+            print(f"{r.program:<18} {r.kind:<8} FAILED: {r.error[:45]}")
+            continue
+        cold = r.stats("cold")
+        for phase in COMPILE_PHASES:
+            st = r.stats(phase)
+            if st is None:
+                continue
+            rel = f"{st['mean_ms'] / cold['mean_ms']:.2f}x" if cold and cold["mean_ms"] else "-"
+            print(
+                f"{r.program:<18} {r.kind:<8} {phase:<6} {st['mean_ms']:<12.1f} "
+                f"{st['min_ms']:<12.1f} {st['stddev_ms']:<10.1f} {rel}"
+            )
+    print()
 
-            for _ in range(warmup):
-                rust_runner.run(binary, input_data.data)
 
-            for _ in range(iterations):
-                output, run_time = rust_runner.run(binary, input_data.data)
-                result.times_ms.append(run_time)
-            result.output_bytes = output
-            if reference_output is not None and output != reference_output:
-                result.error = "Output mismatch with reference"
+# Version tag of the JSON written by --json / --output. Bump it when a field
+# changes meaning; read_snapshot() still accepts the unversioned layout.
+SNAPSHOT_SCHEMA = "x07-perf-compare.snapshot@1"
 
-        except Exception as e:
-            result.success = False
-            result.error = str(e)
 
-        results.append(result)
+def _first_line(text: str) -> str:
+    return text.splitlines()[0] if text else ""
 
-    if go_prog.exists():
-        result = BenchmarkResult(language="Go", benchmark=benchmark)
-        try:
-            binary = tmp_dir / f"{benchmark}_go"
-            result.compile_time_ms = go_runner.compile(go_prog, binary)
-            result.build_size_bytes = binary.stat().st_size
 
-            output, rss_kb = go_runner.run_with_rss(binary, input_data.data)
-            result.peak_rss_kb = rss_kb
-            result.output_bytes = output
-            if reference_output is not None and output != reference_output:
-                result.error = "Output mismatch with reference"
+def environment_fingerprint() -> dict[str, Any]:
+    """Hardware and OS details that decide whether two snapshots are comparable."""
+    env: dict[str, Any] = {
+        "os": platform.system(),
+        "os_release": platform.release(),
+        "platform": platform.platform(),
+        "machine": platform.machine(),
+        "python": platform.python_version(),
+        "logical_cpus": os.cpu_count(),
+    }
+    cpuinfo = _read_sysfs("/proc/cpuinfo")
+    model = next(
+        (line.split(":", 1)[1].strip() for line in cpuinfo.splitlines()
+         if line.startswith("model name")),
+        "",
+    )
+    if not model and sys.platform == "darwin":
+        model = _tool_identity("sysctl", "-n", "machdep.cpu.brand_string")
+    env["cpu_model"] = model
+    meminfo = _read_sysfs("/proc/meminfo")
+    for line in meminfo.splitlines():
+        if line.startswith("MemTotal:"):
+            env["memory_kb"] = int(line.split()[1])
+    if sys.platform == "darwin":
+        mem = _tool_identity("sysctl", "-n", "hw.memsize")
+        if mem.isdigit():
+            env["memory_kb"] = int(mem) // 1024
+    env["cpu_governor"] = cpu_governor(0) or None
+    return env
+
+
+def toolchain_versions(x07_host_runner: Path) -> dict[str, str]:
+    """First line of each toolchain's version banner, plus the x07-host-runner digest."""
+    versions = {
+        "cc": _first_line(_tool_identity("cc", "--version")),
+        "c++": _first_line(_tool_identity("c++", "--version")),
+        "rustc": _first_line(_tool_identity("rustc", "--version")),
+        "cargo": _first_line(_tool_identity("cargo", "--version")),
+        "go": _first_line(_tool_identity("go", "version")),
+        "x07-host-runner": _first_line(_tool_identity(str(x07_host_runner), "--version")),
+    }
+    try:
+        versions["x07-host-runner_sha256"] = _file_digest(x07_host_runner)
+    except OSError:
+        pass
+    return versions
+
+
+def _result_row(
+    r: BenchmarkResult, x07: BenchmarkResult | None, args: argparse.Namespace
+) -> dict[str, Any]:
+    return {
+        "language": r.language,
+        "mean_time_ms": r.mean_time_ms,
+        "min_time_ms": r.min_time_ms,
+        "stddev_time_ms": r.stddev_time_ms,
+        "median_time_ms": r.median_time_ms,
+        "ci95_ms": list(r.ci95_ms) if r.times_ms else None,
+        "runs": len(r.times_ms),
+        "outliers": r.outliers,
+        "p_vs_x07": (
+            x07.p_value_vs(r) if x07 is not None and r is not x07 and r.times_ms
+            else None
+        ),
+        "times_ms": r.times_ms,
+        "input_bytes": r.input_bytes,
+        "processed_bytes": r.processed_bytes,
+        "throughput_mb_s": r.throughput_mb_s,
+        "compile_time_ms": r.compile_time_ms,
+        "compile_cached": r.compile_cached,
+        "build_size_bytes": r.build_size_bytes,
+        "build_flags": r.build_flags,
+        "peak_rss_kb": r.peak_rss_kb,
+        "success": r.success,
+        "error": r.error,
+        "x07_cc_profile": args.x07_cc_profile if r.language == "X07" else None,
+        "threads": r.threads or None,
+        "counters": r.counters or None,
+        "allocations": r.allocations or None,
+        "kernel_time_ms": r.kernel_time_ms if args.kernel_timing else None,
+        "startup_time_ms": r.startup_time_ms if args.kernel_timing else None,
+        "kernel_times_ms": r.kernel_times_ms or None,
+        "startup_times_ms": r.startup_times_ms or None,
+        "serve": r.serve or None,
+        "memory_runs": r.memory_runs or None,
+        "launch_rusage": r.launch_rusage or None,
+        "rss_timeline_kb": r.rss_timeline_kb or None,
+        "host_reports": r.host_reports or None,
+        "direct_times_ms": r.direct_times_ms or None,
+        "core": r.core,
+        "cpu_governor": r.cpu_governor or None,
+    }
+
+
+def build_snapshot(
+    all_results: dict[str, list[BenchmarkResult]],
+    args: argparse.Namespace,
+    x07_host_runner: Path,
+    fits: dict[str, Any],
+    argv: list[str],
+) -> dict[str, Any]:
+    """The versioned snapshot for one run: setup, environment and per-row results."""
+    snapshot: dict[str, Any] = {
+        "schema": SNAPSHOT_SCHEMA,
+        "created": time.strftime("%Y-%m-%dT%H:%M:%S%z"),
+        "argv": argv,
+        "config": {
+            "size_kb": args.size,
+            "sweep": args.sweep,
+            "iterations": args.iterations,
+            "warmup": args.warmup,
+            "target_ci": args.target_ci / 100 or None,
+            "seed": args.seed,
+            "generator": args.generator,
+            "input": "pipe" if args.pipe_input else "file",
+            "x07_mode": "direct" if args.direct else "host",
+            "x07_cc_profile": args.x07_cc_profile,
+            "launcher": args.launcher,
+            "build_variants": args.build_variants or None,
+        },
+        "environment": environment_fingerprint(),
+        "toolchains": toolchain_versions(x07_host_runner),
+        "results": {
+            benchmark: [_result_row(r, _x07_row(results), args) for r in results]
+            for benchmark, results in all_results.items()
+        },
+    }
+    if fits:
+        snapshot["sweep"] = fits
+    return snapshot
+
+
+def _columnar(results: dict[str, list[dict[str, Any]]]) -> dict[str, list[Any]]:
+    """Turn {benchmark: [row, ...]} into one list per field, with a `benchmark` column.
+
+    Field names are stored once instead of per row, which is most of the
+    size of a large sweep; gzip (a .gz --output) takes care of the rest.
+    """
+    rows = [dict(row, benchmark=b) for b, rs in results.items() for row in rs]
+    names = list(dict.fromkeys(name for row in rows for name in row))
+    return {name: [row.get(name) for row in rows] for name in names}
+
+
+def _rows_from_columnar(columns: dict[str, list[Any]]) -> dict[str, list[dict[str, Any]]]:
+    results: dict[str, list[dict[str, Any]]] = {}
+    n = len(columns.get("benchmark", []))
+    for i in range(n):
+        row = {name: values[i] for name, values in columns.items()}
+        results.setdefault(row.pop("benchmark"), []).append(row)
+    return results
 
-            for _ in range(warmup):
-                go_runner.run(binary, input_data.data)
 
-            for _ in range(iterations):
-                output, run_time = go_runner.run(binary, input_data.data)
-                result.times_ms.append(run_time)
-            result.output_bytes = output
-            if reference_output is not None and output != reference_output:
-                result.error = "Output mismatch with reference"
+def write_snapshot(snapshot: dict[str, Any], path: Path, columnar: bool = False) -> None:
+    """Write a snapshot as JSON, gzip-compressed when `path` ends in .gz."""
+    if columnar:
+        snapshot = dict(snapshot, results=_columnar(snapshot["results"]), layout="columnar")
+    text = json.dumps(snapshot, indent=None if columnar else 2)
+    if path.suffix == ".gz":
+        with gzip.open(path, "wt", encoding="utf-8") as f:
+            f.write(text)
+    else:
+        path.write_text(text)
+
+
+def read_snapshot(path: Path) -> dict[str, Any]:
+    """Read a snapshot in any layout, returning the versioned row-major form.
+
+    Unversioned snapshots (a bare {benchmark: [row, ...]} object, as in
+    snapshots/) come back with schema None and their rows under `results`.
+    A `remote` multi-host file is read as one of its hosts' snapshots,
+    picked as `FILE#<fingerprint or host>` (see select_host_snapshot).
+    """
+    select = ""
+    if not path.exists() and "#" in path.name:
+        name, _, select = path.name.partition("#")
+        path = path.with_name(name)
+    if path.suffix == ".gz":
+        with gzip.open(path, "rt", encoding="utf-8") as f:
+            data = json.load(f)
+    else:
+        data = json.loads(path.read_text())
+    if data.get("schema") == MULTIHOST_SCHEMA:
+        data = select_host_snapshot(data, select)
+    if "schema" not in data:
+        return {
+            "schema": None,
+            "results": {k: v for k, v in data.items() if not k.startswith("_")},
+            "sweep": data.get("_sweep"),
+        }
+    if data.get("layout") == "columnar":
+        data = dict(data, results=_rows_from_columnar(data["results"]))
+        data.pop("layout")
+    return data
+
+
+# Row fields compared by `compare`, by the name used in --gate.
+COMPARE_METRICS = {
+    "time": "median_time_ms",
+    "rss": "peak_rss_kb",
+    "size": "build_size_bytes",
+    "compile": "compile_time_ms",
+}
+
+# Two-sided 95% Student t quantiles for 1..30 degrees of freedom, used to
+# build a CI around a mean from its stddev.
+_T95 = (
+    12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+    2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+    2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042,
+)
+
+
+def t95(df: int) -> float:
+    """Two-sided 95% t quantile for `df` degrees of freedom.
+
+    Past the table, the Cornish-Fisher expansion around the normal quantile,
+    which is within 0.001 there.
+    """
+    df = max(df, 1)
+    if df <= len(_T95):
+        return _T95[df - 1]
+    z = 1.959964
+    return z + (z**3 + z) / (4 * df) + (5 * z**5 + 16 * z**3 + 3 * z) / (96 * df**2)
+
+
+def load_snapshot(path: Path) -> dict[tuple[str, str], dict[str, Any]]:
+    """Load a snapshot (see read_snapshot) as {(benchmark, language): row}."""
+    rows = {}
+    for benchmark, results in read_snapshot(path)["results"].items():
+        if not isinstance(results, list):
+            continue
+        for row in results:
+            rows[(benchmark, row["language"])] = row
+    return rows
 
-        except Exception as e:
-            result.success = False
-            result.error = str(e)
 
-        results.append(result)
+def _has_median(row: dict[str, Any]) -> bool:
+    return bool(row.get("times_ms") or (row.get("median_time_ms") and row.get("ci95_ms")))
 
-    return results
 
+def _snapshot_time(
+    row: dict[str, Any], statistic: str
+) -> tuple[float, tuple[float, float]] | None:
+    """Run time of a snapshot row as `statistic` (median or mean) and a 95% CI.
 
-def print_results(
-    all_results: dict[str, list[BenchmarkResult]],
-    input_size_kb: int,
-    direct_mode: bool = False,
-    x07_cc_profile: str = "default",
+    The median comes from the raw runs, or else the stored median and
+    bootstrap CI. The mean comes from the raw runs, or else the stored mean
+    and stddev, with a CI of mean +/- t * stddev / sqrt(runs). Snapshots from
+    before medians existed only have the mean.
+    """
+    if not row.get("success", True):
+        return None
+    times = row.get("times_ms")
+    if statistic == "median":
+        if times:
+            clean = reject_outliers(times)
+            return statistics.median(clean), bootstrap_ci(clean)
+        if row.get("median_time_ms") and row.get("ci95_ms"):
+            lo, hi = row["ci95_ms"]
+            return row["median_time_ms"], (lo, hi)
+        return None
+    if times:
+        mean, runs = statistics.mean(times), len(times)
+        stddev = statistics.stdev(times) if runs > 1 else 0.0
+    else:
+        mean = row.get("mean_time_ms")
+        # Unversioned snapshots did not record their run count; 5 was the default.
+        runs = row.get("runs") or 5
+        stddev = row.get("stddev_time_ms", 0.0)
+    if not mean:
+        return None
+    half = t95(runs - 1) * stddev / math.sqrt(runs)
+    return mean, (mean - half, mean + half)
+
+
+def compare_rows(old: dict[str, Any], new: dict[str, Any]) -> dict[str, Any]:
+    """Relative change (new / old - 1) per COMPARE_METRICS entry for one row.
+
+    Time compares medians, or means when either row has no median, so both
+    sides always use the same statistic. It carries `significant`: a
+    Mann-Whitney test when both rows have raw runs, otherwise whether the two
+    95% CIs are disjoint. The other metrics come from a single run or are
+    deterministic, so any change counts. Compile time is left out when
+    either row replayed it from the build cache, since it was not measured.
+    """
+    out: dict[str, Any] = {}
+    statistic = "median" if _has_median(old) and _has_median(new) else "mean"
+    t_old, t_new = _snapshot_time(old, statistic), _snapshot_time(new, statistic)
+    if t_old and t_new and t_old[0] > 0:
+        if statistic == "median" and old.get("times_ms") and new.get("times_ms"):
+            significant = mann_whitney_p(
+                reject_outliers(old["times_ms"]), reject_outliers(new["times_ms"])
+            ) < SIGNIFICANCE_ALPHA
+        else:
+            (lo_a, hi_a), (lo_b, hi_b) = t_old[1], t_new[1]
+            significant = hi_a < lo_b or hi_b < lo_a
+        out["time"] = {
+            "old": t_old[0], "new": t_new[0], "statistic": statistic,
+            "change": t_new[0] / t_old[0] - 1, "significant": significant,
+        }
+    for metric, key in COMPARE_METRICS.items():
+        if metric == "time":
+            continue
+        if metric == "compile" and (old.get("compile_cached") or new.get("compile_cached")):
+            continue
+        a, b = old.get(key), new.get(key)
+        if a and b:
+            out[metric] = {"old": a, "new": b, "change": b / a - 1, "significant": a != b}
+    return out
+
+
+def compare_snapshots(
+    paths: list[Path], threshold: float, gate: list[str], languages: list[str] | None
+) -> tuple[list[dict[str, Any]], bool]:
+    """Compare every snapshot after the first against the first.
+
+    Returns one entry per (snapshot, benchmark, language) row and whether any
+    gated metric regressed significantly by more than `threshold` (a fraction).
+    """
+    baseline = load_snapshot(paths[0])
+    entries = []
+    failed = False
+    for path in paths[1:]:
+        current = load_snapshot(path)
+        for key in list(baseline) + [k for k in current if k not in baseline]:
+            benchmark, language = key
+            if languages and language not in languages:
+                continue
+            entry: dict[str, Any] = {
+                "snapshot": str(path), "benchmark": benchmark, "language": language,
+            }
+            if key not in current or key not in baseline:
+                entry["status"] = "missing" if key not in current else "added"
+            else:
+                entry["metrics"] = compare_rows(baseline[key], current[key])
+                regressed = [
+                    m for m in gate
+                    if (c := entry["metrics"].get(m)) and c["significant"] and c["change"] > threshold
+                ]
+                entry["regressed"] = regressed
+                failed = failed or bool(regressed)
+                entry["status"] = "REGRESSION" if regressed else "ok"
+            entries.append(entry)
+    return entries, failed
+
+
+def print_compare_table(
+    paths: list[Path], entries: list[dict[str, Any]], threshold: float
 ) -> None:
-    """Print benchmark results in a formatted table."""
+    """Print per-row changes against the baseline snapshot."""
+    for path in paths[1:]:
+        print()
+        print("=" * 100)
+        print(f"{paths[0].name} -> {path.name} (regression threshold: {threshold * 100:.1f}%)")
+        print("=" * 100)
+        print(
+            f"{'Benchmark':<26} {'Language':<12} {'Time (ms)':<20} {'Time':<10} "
+            f"{'RSS':<9} {'Size':<9} {'Compile':<9} {'Status'}"
+        )
+        print("-" * 100)
+        for e in entries:
+            if e["snapshot"] != str(path):
+                continue
+            metrics = e.get("metrics", {})
+
+            def cell(metric: str) -> str:
+                c = metrics.get(metric)
+                if not c:
+                    return "-"
+                return f"{c['change'] * 100:+.1f}%" + ("" if c["significant"] else "~")
+
+            t = metrics.get("time")
+            times = f"{t['old']:.3f} -> {t['new']:.3f}" if t else "-"
+            if t and t["statistic"] == "mean":
+                times += " *"
+            print(
+                f"{e['benchmark']:<26} {e['language']:<12} {times:<20} {cell('time'):<10} "
+                f"{cell('rss'):<9} {cell('size'):<9} {cell('compile'):<9} {e['status']}"
+            )
     print()
-    print("=" * 80)
-    mode_str = "direct binary" if direct_mode else "host runner"
-    print(
-        f"Performance Benchmark Results (input size: {input_size_kb} KB, X07 mode: {mode_str}, cc-profile: {x07_cc_profile})"
-    )
-    print("=" * 80)
+    print("Legend: +% = new is slower / larger; ~ = within noise (CI overlap or Mann-Whitney "
+          f"p >= {SIGNIFICANCE_ALPHA})")
+    print("Times are medians; * = means on both sides, because one snapshot has no medians")
     print()
 
-    for benchmark, results in all_results.items():
-        print(f"Benchmark: {benchmark}")
-        print("-" * 70)
-        print(
-            f"{'Language':<12} {'Mean (ms)':<12} {'Min (ms)':<12} {'StdDev':<10} "
-            f"{'Compile (ms)':<12} {'Build (KiB)':<12} {'RSS (KiB)':<10} {'Status'}"
+
+def compare_main(argv: list[str]) -> int:
+    ap = argparse.ArgumentParser(
+        prog="run_benchmarks.py compare",
+        description="Compare benchmark snapshots against the first one given",
+    )
+    ap.add_argument("snapshots", nargs="+", type=Path,
+                    help="Snapshot JSON files; the first is the baseline")
+    ap.add_argument(
+        "--threshold",
+        type=float,
+        default=5.0,
+        metavar="PCT",
+        help="Fail when a gated metric is significantly worse by more than PCT%% (default: 5)",
+    )
+    ap.add_argument(
+        "--gate",
+        default="time",
+        help=f"Comma-separated metrics that can fail the comparison: "
+             f"{','.join(COMPARE_METRICS)} (default: time)",
+    )
+    ap.add_argument("--languages", default=None,
+                    help="Only compare these comma-separated languages (e.g. X07)")
+    ap.add_argument("--json", action="store_true", help="Output the comparison as JSON")
+    args = ap.parse_args(argv)
+
+    if len(args.snapshots) < 2:
+        ap.error("compare needs at least two snapshots")
+    gate = [m.strip() for m in args.gate.split(",") if m.strip()]
+    unknown = [m for m in gate if m not in COMPARE_METRICS]
+    if unknown:
+        ap.error(f"unknown --gate metrics: {', '.join(unknown)}")
+    languages = [l.strip() for l in args.languages.split(",")] if args.languages else None
+
+    try:
+        entries, failed = compare_snapshots(
+            args.snapshots, args.threshold / 100, gate, languages
         )
-        print("-" * 70)
+    except (OSError, ValueError, KeyError) as e:
+        print(f"error: cannot load snapshot: {e}", file=sys.stderr)
+        return 2
 
-        x07_time = None
-        for r in results:
-            if r.language == "X07" and r.success:
-                x07_time = r.mean_time_ms
-                break
+    if args.json:
+        print(json.dumps({"failed": failed, "rows": entries}, indent=2))
+    else:
+        print_compare_table(args.snapshots, entries, args.threshold / 100)
+        if failed:
+            print(f"FAIL: regressions past {args.threshold:.1f}% in: {', '.join(gate)}")
+    return 1 if failed else 0
+
+
+# `remote`: what is copied to each host (build output directories such as
+# target/ are left out), and where each host's run writes its snapshot
+# (with a per-run id, so a file left by an earlier run is never fetched).
+REMOTE_SUITE = ("run_benchmarks.py", "c", "rust", "rust_cargo", "go", "x07", "projects", "tools")
+_REMOTE_SKIP = ("target", "__pycache__", ".git")
+REMOTE_SNAPSHOT = "remote-snapshot-{run_id}.json"
+MULTIHOST_SCHEMA = "x07-perf-compare.multihost@1"
+
+
+def hardware_fingerprint(env: dict[str, Any]) -> str:
+    """A readable key for a machine: OS, ISA, CPU model, CPU count and memory.
+
+    Hosts with the same key are the same kind of machine, so their results
+    can be read as repeats of each other.
+    """
+    memory_gib = round((env.get("memory_kb") or 0) / (1024 * 1024))
+    parts = [
+        env.get("os", ""), env.get("machine", ""), env.get("cpu_model", ""),
+        f"{env.get('logical_cpus')}cpu", f"{memory_gib}gib",
+    ]
+    return re.sub(r"[^a-z0-9]+", "-", " ".join(str(p) for p in parts).lower()).strip("-")
 
-        for r in results:
-            status = "OK" if r.success else f"FAIL: {r.error[:30]}"
-            if r.error and r.success:
-                status = f"WARN: {r.error[:25]}"
 
-            speedup = ""
-            if x07_time and r.success and r.mean_time_ms > 0:
-                ratio = x07_time / r.mean_time_ms
-                if r.language != "X07":
-                    speedup = f" ({ratio:.2f}x)"
+def select_host_snapshot(data: dict[str, Any], select: str) -> dict[str, Any]:
+    """One host's snapshot from a multi-host file.
 
-            build_kib = r.build_size_bytes / 1024 if r.build_size_bytes else 0.0
-            print(
-                f"{r.language:<12} "
-                f"{r.mean_time_ms:<12.2f} "
-                f"{r.min_time_ms:<12.2f} "
-                f"{r.stddev_time_ms:<10.2f} "
-                f"{r.compile_time_ms:<12.1f} "
-                f"{build_kib:<12.1f} "
-                f"{r.peak_rss_kb:<10d} "
-                f"{status}{speedup}"
-            )
+    `select` is a fingerprint or a host name. It may be empty when the file
+    holds a single host.
+    """
+    runs = [(fp, run) for fp, host_runs in data["hosts"].items() for run in host_runs]
+    matches = [(fp, run) for fp, run in runs if select in (fp, run["host"])] if select else runs
+    if len(matches) == 1 or (matches and select):
+        return matches[0][1]["snapshot"]
+    known = ", ".join(f"{fp} ({run['host']})" for fp, run in runs) or "none"
+    if select:
+        raise ValueError(f"no host {select!r} in the file; hosts: {known}")
+    raise ValueError(f"pick a host with FILE#<fingerprint or host>; hosts: {known}")
 
-        print()
 
-    print()
-    print("Legend:")
-    print("  - Mean/Min/StdDev: Execution time statistics over multiple runs")
-    print("  - Compile: One-time compilation overhead")
-    print("  - Build: Final executable size")
-    print("  - RSS: Peak resident set size (one run)")
-    print("  - Speedup (Nx): How many times faster than X07")
-    print()
+def _ssh(ssh: list[str], host: str, command: str, **kwargs: Any) -> subprocess.CompletedProcess:
+    return subprocess.run(ssh + [host, command], **kwargs)
 
 
-def print_summary_table(all_results: dict[str, list[BenchmarkResult]]) -> None:
-    """Print a summary comparison table."""
+def _ship_suite(
+    ssh: list[str], host: str, perf_dir: Path, remote_dir: str, caches: list[tuple[Path, str]]
+) -> None:
+    """Stream the suite and `caches` ((local dir, remote name)) to `host` as a tarball."""
+    q = shlex.quote(remote_dir)
+    proc = subprocess.Popen(
+        ssh + [host, f"mkdir -p {q} && tar xzf - -C {q}"],
+        stdin=subprocess.PIPE,
+        stderr=subprocess.PIPE,
+    )
+
+    def keep(info: tarfile.TarInfo) -> tarfile.TarInfo | None:
+        return None if any(part in _REMOTE_SKIP for part in Path(info.name).parts) else info
+
+    try:
+        with tarfile.open(fileobj=proc.stdin, mode="w|gz") as tar:
+            for name in REMOTE_SUITE:
+                if (perf_dir / name).exists():
+                    tar.add(perf_dir / name, arcname=name, filter=keep)
+            for local, remote in caches:
+                if local.is_dir():
+                    tar.add(local, arcname=remote)
+    except BrokenPipeError:
+        pass
+    _, err = proc.communicate()
+    if proc.returncode != 0:
+        detail = err.decode(errors="replace").strip() or f"exit {proc.returncode}"
+        raise RuntimeError(f"copying the suite failed: {detail}")
+
+
+def _run_remote_host(
+    ssh: list[str],
+    host: str,
+    perf_dir: Path,
+    remote_dir: str,
+    runner_args: list[str],
+    caches: list[tuple[Path, str]],
+    run_id: str,
+) -> dict[str, Any]:
+    """Ship the suite to `host`, run it there and return the host's snapshot.
+
+    Raises when the run exits non-zero, so a failed run is never merged.
+    """
+    print(f"[{host}] copying suite to {remote_dir}", file=sys.stderr)
+    _ship_suite(ssh, host, perf_dir, remote_dir, caches)
+
+    args = list(runner_args)
+    for _, name in caches:
+        if "--input-cache" not in args:
+            args += ["--input-cache", name]
+    snapshot = REMOTE_SNAPSHOT.format(run_id=run_id)
+    command = (
+        f"cd {shlex.quote(remote_dir)} && rm -f {shlex.quote(snapshot)} && "
+        f"python3 run_benchmarks.py {shlex.join(args + ['--output', snapshot])}"
+    )
+    print(f"[{host}] running: {command}", file=sys.stderr)
+    proc = subprocess.Popen(
+        ssh + [host, command], stdout=subprocess.DEVNULL, stderr=subprocess.PIPE, text=True
+    )
+    for line in proc.stderr:
+        print(f"[{host}] {line.rstrip()}", file=sys.stderr)
+    if proc.wait() != 0:
+        raise RuntimeError(f"run failed (exit {proc.returncode})")
+
+    path = shlex.quote(f"{remote_dir}/{snapshot}")
+    fetched = _ssh(ssh, host, f"cat {path} && rm -f {path}", capture_output=True)
+    if fetched.returncode != 0 or not fetched.stdout:
+        detail = fetched.stderr.decode(errors="replace").strip()
+        raise RuntimeError(f"cannot fetch {snapshot}: {detail or 'empty file'}")
+    return json.loads(fetched.stdout)
+
+
+def merge_host_snapshots(
+    snapshots: dict[str, dict[str, Any]], failed: dict[str, str], argv: list[str]
+) -> dict[str, Any]:
+    """One multi-host document: each host's snapshot under its hardware fingerprint."""
+    hosts: dict[str, list[dict[str, Any]]] = {}
+    for host, snapshot in snapshots.items():
+        fp = hardware_fingerprint(snapshot.get("environment", {}))
+        hosts.setdefault(fp, []).append({"host": host, "snapshot": snapshot})
+    return {
+        "schema": MULTIHOST_SCHEMA,
+        "created": time.strftime("%Y-%m-%dT%H:%M:%S%z"),
+        "argv": argv,
+        "hosts": hosts,
+        "failed": failed or None,
+    }
+
+
+def print_multihost_table(merged: dict[str, Any]) -> None:
+    """Print X07's median per host next to its ratio to the fastest other row there."""
+    runs = [(fp, run) for fp, host_runs in merged["hosts"].items() for run in host_runs]
+    if not runs:
+        return
+    columns = []
+    for fp, run in runs:
+        rows = run["snapshot"].get("results", {})
+        if run["snapshot"].get("layout") == "columnar":
+            rows = _rows_from_columnar(rows)
+        columns.append((fp, run["host"], rows))
+    benchmarks = list(dict.fromkeys(b for _, _, rows in columns for b in rows))
+
     print()
-    print("=" * 60)
-    print("Summary: Relative Performance (X07 = 1.0x)")
-    print("=" * 60)
+    print("=" * 100)
+    print("X07 per host (median ms, and X07 time / fastest other language on that host)")
+    print("=" * 100)
+    for i, (fp, host, _) in enumerate(columns, 1):
+        print(f"  [{i}] {host}: {fp}")
+    print()
+    print(f"{'Benchmark':<28} " + " ".join(f"{f'[{i}]':<20}" for i in range(1, len(columns) + 1)))
+    print("-" * 100)
+    for benchmark in benchmarks:
+        cells = []
+        for _, _, rows in columns:
+            ok = [r for r in rows.get(benchmark, []) if r.get("success") and r.get("median_time_ms")]
+            x07 = next((r for r in ok if r["language"] == "X07"), None)
+            others = [r["median_time_ms"] for r in ok if r["language"] != "X07"]
+            if x07 is None:
+                cells.append("-")
+            elif others:
+                cells.append(f"{x07['median_time_ms']:.3f} ({x07['median_time_ms'] / min(others):.2f}x)")
+            else:
+                cells.append(f"{x07['median_time_ms']:.3f}")
+        print(f"{benchmark:<28} " + " ".join(f"{c:<20}" for c in cells))
     print()
-    print(f"{'Benchmark':<20} {'X07':<12} {'C':<12} {'Rust':<12} {'Go':<12}")
-    print("-" * 60)
-
-    for benchmark, results in all_results.items():
-        row = {"X07": "1.0x", "C": "N/A", "Rust": "N/A", "Go": "N/A"}
 
-        x07_time = None
-        for r in results:
-            if r.language == "X07" and r.success:
-                x07_time = r.mean_time_ms
-                break
 
-        if x07_time and x07_time > 0:
-            for r in results:
-                if r.success and r.mean_time_ms > 0:
-                    ratio = x07_time / r.mean_time_ms
-                    row[r.language] = f"{ratio:.2f}x"
+def remote_main(argv: list[str]) -> int:
+    ap = argparse.ArgumentParser(
+        prog="run_benchmarks.py remote",
+        description="Run the suite on remote hosts over SSH and merge the snapshots",
+    )
+    ap.add_argument("--hosts", default="",
+                    help="Comma-separated SSH destinations (e.g. user@build-arm64,x86-box)")
+    ap.add_argument("--hosts-file", type=Path, default=None,
+                    help="File with one SSH destination per line (# starts a comment)")
+    ap.add_argument("--remote-dir", default="x07-perf-compare",
+                    help="Suite directory on each host, relative to its home (default: x07-perf-compare)")
+    ap.add_argument("--ssh", default="ssh -o BatchMode=yes",
+                    help="SSH command to use (default: 'ssh -o BatchMode=yes')")
+    ap.add_argument("--ship-inputs", action="store_true",
+                    help="Also copy the local input cache to the hosts (default: each host generates its own)")
+    ap.add_argument("--output", type=Path, default=Path("multihost.json"),
+                    help="Merged multi-host snapshot (default: multihost.json)")
+    ap.add_argument("runner_args", nargs=argparse.REMAINDER,
+                    help="Arguments for run_benchmarks.py on each host, after --")
+    args = ap.parse_args(argv)
 
-        print(
-            f"{benchmark:<20} {row['X07']:<12} {row['C']:<12} {row['Rust']:<12} {row['Go']:<12}"
-        )
+    hosts = [h.strip() for h in args.hosts.split(",") if h.strip()]
+    if args.hosts_file:
+        for line in args.hosts_file.read_text().splitlines():
+            line = line.split("#", 1)[0].strip()
+            if line:
+                hosts.append(line)
+    if not hosts:
+        ap.error("no hosts: pass --hosts or --hosts-file")
+    runner_args = args.runner_args[1:] if args.runner_args[:1] == ["--"] else args.runner_args
+    ssh = shlex.split(args.ssh)
+
+    # Inputs do not depend on the machine, but the cache holds every input
+    # ever generated, often GBs of incompressible bytes, so it only goes
+    # along on request. The build cache never does: its keys include the CPU,
+    # so entries would not hit on the other machines this command is for.
+    caches = [(_default_input_cache_dir(), ".cache/inputs")] if args.ship_inputs else []
+    perf_dir = Path(__file__).resolve().parent
+    run_id = f"{time.strftime('%Y%m%dT%H%M%S')}-{os.getpid()}"
+
+    snapshots: dict[str, dict[str, Any]] = {}
+    failed: dict[str, str] = {}
+    with ThreadPoolExecutor(max_workers=len(hosts)) as pool:
+        futures = {
+            host: pool.submit(
+                _run_remote_host,
+                ssh, host, perf_dir, args.remote_dir, runner_args, caches, run_id,
+            )
+            for host in hosts
+        }
+        for host, future in futures.items():
+            try:
+                snapshots[host] = future.result()
+            except Exception as e:
+                failed[host] = str(e)
+                print(f"[{host}] error: {e}", file=sys.stderr)
 
-    print()
+    merged = merge_host_snapshots(snapshots, failed, ["remote"] + argv)
+    write_snapshot(merged, args.output)
+    print(f"Wrote multi-host snapshot: {args.output}", file=sys.stderr)
+    print_multihost_table(merged)
+    return 1 if failed else 0
 
 
 def main(argv: list[str]) -> int:
+    if argv and argv[0] == "compare":
+        return compare_main(argv[1:])
+    if argv and argv[0] == "remote":
+        return remote_main(argv[1:])
+
     ap = argparse.ArgumentParser(description="Run performance comparison benchmarks")
     ap.add_argument(
         "--x07-host-runner",
@@ -1121,8 +5269,31 @@ def main(argv: list[str]) -> int:
     ap.add_argument("--size", type=int, default=100, help="Input size in KB (default: 100)")
     ap.add_argument("--iterations", type=int, default=5, help="Number of iterations (default: 5)")
     ap.add_argument("--warmup", type=int, default=2, help="Warmup iterations (default: 2)")
+    ap.add_argument(
+        "--target-ci",
+        type=float,
+        default=0.0,
+        metavar="PCT",
+        help=(
+            "Keep sampling each row past --iterations until the median's 95%% CI is "
+            "within +/-PCT%% of it (default: off)"
+        ),
+    )
+    ap.add_argument(
+        "--time-budget",
+        type=float,
+        default=10.0,
+        metavar="SECONDS",
+        help="Per-row time limit for --target-ci sampling (default: 10)",
+    )
+    ap.add_argument(
+        "--max-iterations",
+        type=int,
+        default=200,
+        help="Per-row run limit for --target-ci sampling (default: 200)",
+    )
     ap.add_argument("--benchmarks", nargs="+", default=None,
-                    help="Specific benchmarks to run (default: all)")
+                    help="Specific benchmarks to run, optionally as name:case (default: all)")
     ap.add_argument("--json", action="store_true", help="Output results as JSON")
     ap.add_argument("--direct", action="store_true",
                     help="Run X07 binaries directly (no host runner overhead)")
@@ -1132,6 +5303,210 @@ def main(argv: list[str]) -> int:
         default=os.environ.get("X07_CC_PROFILE", "default").lower(),
         help="Pass through to x07-host-runner --cc-profile (default: default)",
     )
+    ap.add_argument(
+        "--c-io",
+        choices=["stdio", "tuned", "both"],
+        default="both",
+        help="C input layer: naive getchar() loop (C), read/mmap (C-io), or both (default: both)",
+    )
+    ap.add_argument(
+        "--streaming",
+        action="store_true",
+        help="Also run the constant-memory *_stream variants (C-stream, Rust-stream, Go-stream)",
+    )
+    ap.add_argument(
+        "--simd",
+        action="store_true",
+        help="Also run the hand-vectorized C kernels (*_simd.c) as a C-simd row",
+    )
+    ap.add_argument(
+        "--pipeline",
+        action="store_true",
+        help="Also run the pipeline benchmark: fused programs vs their stages joined by pipes",
+    )
+    ap.add_argument(
+        "--threads",
+        default=None,
+        help="Comma-separated thread counts (e.g. 1,2,4,8) for the *_par variants",
+    )
+    ap.add_argument(
+        "--regex-backends",
+        default="auto",
+        help=(
+            "Extra C regex engines for the regex_* benchmarks: comma-separated from "
+            f"{', '.join(['posix'] + list(C_REGEX_BACKENDS))}, or 'auto' for those "
+            "pkg-config can find (default: auto; posix is always built as C)"
+        ),
+    )
+    ap.add_argument(
+        "--regex-patterns",
+        default=None,
+        help=f"Comma-separated regex cases to run (default: all of {', '.join(REGEX_PATTERNS)})",
+    )
+    ap.add_argument(
+        "--counters",
+        action="store_true",
+        help=(
+            "Collect cycles, instructions, LLC and branch misses and page faults "
+            "from one extra run per row (perf stat on Linux, time -l on macOS)"
+        ),
+    )
+    ap.add_argument(
+        "--kernel-timing",
+        action="store_true",
+        help=(
+            "Split run time into startup and kernel using the programs' in-process "
+            "timers (X07: estimated from empty-input runs)"
+        ),
+    )
+    ap.add_argument(
+        "--sweep",
+        default=None,
+        help=(
+            "Run each benchmark at geometric input sizes LO..HI (e.g. 4K..1G) instead of "
+            "--size, and fit time = startup + per_byte * bytes"
+        ),
+    )
+    ap.add_argument(
+        "--sweep-step",
+        type=int,
+        default=4,
+        help="Size multiplier between --sweep points (default: 4)",
+    )
+    ap.add_argument(
+        "--serve",
+        type=int,
+        default=0,
+        metavar="N",
+        help=(
+            "Also send N back-to-back requests to one long-lived process per C/Rust/Go "
+            "program and report p50/p99/p99.9 latency and requests/s"
+        ),
+    )
+    ap.add_argument(
+        "--jobs",
+        type=int,
+        default=1,
+        help=(
+            "Run up to N benchmarks concurrently, each pinned to its own core "
+            "(default: 1; implies --pin)"
+        ),
+    )
+    ap.add_argument(
+        "--pin",
+        action="store_true",
+        help="Pin measured processes to dedicated cores (Linux sched_setaffinity)",
+    )
+    ap.add_argument(
+        "--cpus",
+        default=None,
+        help=(
+            "CPU list to pin to, e.g. 2-5 or 2,4,6 (default: isolated CPUs, else all "
+            "allowed CPUs but 0, one per physical core)"
+        ),
+    )
+    ap.add_argument(
+        "--build-cache",
+        type=Path,
+        default=None,
+        help=(
+            "Directory of cached binaries keyed by source, toolchain, flags and CPU "
+            "(default: $X07_PERF_BUILD_CACHE or ~/.cache/x07-perf-compare/builds)"
+        ),
+    )
+    ap.add_argument(
+        "--no-build-cache",
+        action="store_true",
+        help="Build every program from scratch and leave the cache untouched",
+    )
+    ap.add_argument(
+        "--fresh-compile",
+        action="store_true",
+        help="Rebuild (and re-time) every program, replacing its cache entry",
+    )
+    ap.add_argument(
+        "--allocators",
+        default=None,
+        help=(
+            "Re-run C, Rust and X07 binaries with these allocators preloaded, e.g. "
+            "jemalloc,mimalloc, name=/path/lib.so, or auto for every one found"
+        ),
+    )
+    ap.add_argument(
+        "--alloc-count",
+        action="store_true",
+        help="Count mallocs, bytes and realloc copies per row with tools/alloc_count.c (glibc)",
+    )
+    ap.add_argument(
+        "--build-variants",
+        default="",
+        metavar="LIST",
+        help="Extra rows per build variant: O2, lto, generic (no -march), size, pgo, or all",
+    )
+    ap.add_argument(
+        "--launcher",
+        choices=["python", "native"],
+        default="python",
+        help="Time runs from Python (default) or in batches with tools/launcher.c (posix_spawn, wait4)",
+    )
+    ap.add_argument(
+        "--memory",
+        action="store_true",
+        help="Record page faults and a sampled RSS timeline (/proc/<pid>/status) in the timed runs",
+    )
+    ap.add_argument(
+        "--seed",
+        type=int,
+        default=42,
+        help="Seed for the input generators, recorded in the snapshot (default: 42)",
+    )
+    ap.add_argument(
+        "--generator",
+        choices=["auto", "exact", "fast"],
+        default="auto",
+        help=(
+            "Input generators: exact (byte-compatible with older snapshots), fast (bulk, "
+            f"same distributions), or auto: fast from {FAST_GENERATOR_MIN_KB // 1024}M up"
+        ),
+    )
+    ap.add_argument(
+        "--input-cache",
+        type=Path,
+        default=None,
+        help=(
+            "Directory of generated input files fed to the programs as stdin "
+            "(default: $X07_PERF_INPUT_CACHE or ~/.cache/x07-perf-compare/inputs)"
+        ),
+    )
+    ap.add_argument(
+        "--no-input-cache",
+        action="store_true",
+        help="Write input files into the temporary directory only",
+    )
+    ap.add_argument(
+        "--pipe-input",
+        action="store_true",
+        help="Pipe each input from the runner instead of redirecting a file (the old behavior)",
+    )
+    ap.add_argument(
+        "--output",
+        type=Path,
+        default=None,
+        help="Also write the snapshot to this file (gzip-compressed if it ends in .gz)",
+    )
+    ap.add_argument(
+        "--columnar",
+        action="store_true",
+        help="Store snapshot rows as one list per field (compact for large sweeps)",
+    )
+    ap.add_argument(
+        "--compile-bench",
+        action="store_true",
+        help=(
+            "Instead of runtime benchmarks, time X07 builds of the selected programs: "
+            "cold, no-op rebuild, and rebuild after a one-function edit"
+        ),
+    )
     args = ap.parse_args(argv)
 
     perf_repo_root = _perf_repo_root()
@@ -1145,66 +5520,300 @@ def main(argv: list[str]) -> int:
     all_benchmarks = [
         "sum_bytes",
         "word_count",
+        "word_count:adversarial",
+        "word_count_utf8",
         "rle_encode",
+        "rle_encode:long",
+        "rle_decode",
         "byte_freq",
-        "fibonacci",
-        # "regex_is_match",
-        # "regex_count",
-        # "regex_replace",
+        "byte_freq_wide",
+        "word_freq",
+        "fib_big",
+        "sort_u32",
+        "particles_aos",
+        "particles_soa",
+        "regex_is_match",
+        "regex_count",
+        "regex_replace",
     ]
-    benchmarks = args.benchmarks if args.benchmarks else all_benchmarks
+    cases = dict(BENCHMARK_CASES)
+    if args.regex_patterns:
+        patterns = [p.strip() for p in args.regex_patterns.split(",") if p.strip()]
+        unknown = [p for p in patterns if p not in REGEX_PATTERNS]
+        if unknown:
+            ap.error(f"unknown --regex-patterns entries: {', '.join(unknown)}")
+        for name in ("regex_is_match", "regex_count", "regex_replace"):
+            cases[name] = patterns
+    benchmarks = _expand_benchmarks(args.benchmarks if args.benchmarks else all_benchmarks, cases)
+    if args.pipeline and not any(_split_benchmark(b)[0] == "pipeline" for b in benchmarks):
+        benchmarks.append("pipeline")
+    for b in benchmarks:
+        base, case = _split_benchmark(b)
+        if base == "fib_big":
+            try:
+                _fib_big_n(case)
+            except ValueError as e:
+                ap.error(str(e))
+        elif base.startswith("regex_") and case and case not in REGEX_PATTERNS:
+            ap.error(f"unknown regex case in {b} (known: {', '.join(REGEX_PATTERNS)})")
+
+    if args.compile_bench:
+        bases = list(dict.fromkeys(_split_benchmark(b)[0] for b in benchmarks))
+        compile_results = []
+        with tempfile.TemporaryDirectory(prefix="perf_compile_") as tmp:
+            for base in bases:
+                print(f"Timing X07 builds: {base}...", file=sys.stderr)
+                r = run_compile_benchmark(
+                    base, x07_host_runner, perf_repo_root, Path(tmp),
+                    iterations=args.iterations, x07_cc_profile=args.x07_cc_profile,
+                )
+                if r is not None:
+                    compile_results.append(r)
+        if args.json:
+            print(json.dumps({
+                r.program: {
+                    "kind": r.kind,
+                    "x07_cc_profile": args.x07_cc_profile,
+                    "error": r.error,
+                    **{
+                        phase: {**(r.stats(phase) or {}), "times_ms": r.times_ms.get(phase, [])}
+                        for phase in COMPILE_PHASES
+                    },
+                }
+                for r in compile_results
+            }, indent=2))
+        else:
+            print_compile_table(compile_results, args.x07_cc_profile)
+        return 0 if all(r.error is None for r in compile_results) else 1
+
+    variants: list[str] = []
+    if args.streaming:
+        variants.append("stream")
+    if args.simd:
+        variants.append("simd")
+
+    regex_backends = _resolve_regex_backends(args.regex_backends)
+    unknown = [name for name in regex_backends if name not in C_REGEX_BACKENDS]
+    if unknown:
+        ap.error(f"unknown --regex-backends entries: {', '.join(unknown)}")
+
+    threads: list[int] = []
+    if args.threads:
+        try:
+            threads = [int(t) for t in args.threads.split(",") if t.strip()]
+        except ValueError:
+            ap.error(f"--threads expects a comma-separated list of integers: {args.threads}")
+        if any(t < 1 or t > MAX_THREADS for t in threads):
+            ap.error(f"--threads values must be between 1 and {MAX_THREADS}")
+
+    if args.counters and not _counters_available():
+        print(
+            "warning: --counters needs `perf` (Linux) or /usr/bin/time (macOS); "
+            "counters will be empty",
+            file=sys.stderr,
+        )
+
+    # (results key, benchmark, size in KiB); sweep points are keyed `name@size`.
+    runs = [(benchmark, benchmark, args.size) for benchmark in benchmarks]
+    if args.sweep:
+        try:
+            sizes_kb = _sweep_sizes_kb(args.sweep, args.sweep_step)
+        except ValueError as e:
+            ap.error(str(e))
+        runs = []
+        for benchmark in benchmarks:
+            if _split_benchmark(benchmark)[0] in SWEEP_FIXED_INPUT:
+                print(f"Skipping {benchmark} in --sweep: input size is fixed", file=sys.stderr)
+                continue
+            runs.extend((f"{benchmark}@{_format_size_kb(kb)}", benchmark, kb) for kb in sizes_kb)
+
+    if args.target_ci < 0:
+        ap.error("--target-ci must be >= 0")
+    if args.jobs < 1:
+        ap.error("--jobs must be >= 1")
+    if args.serve < 0:
+        ap.error("--serve must be >= 0")
+    cores: list[int | None] = [None]
+    housekeeping: set[int] = set()
+    if args.pin or args.jobs > 1 or args.cpus:
+        if not hasattr(os, "sched_setaffinity"):
+            print("warning: core pinning is not supported on this platform", file=sys.stderr)
+        else:
+            try:
+                pinned = _parse_cpu_list(args.cpus) if args.cpus else pinnable_cores()
+            except ValueError:
+                ap.error(f"--cpus expects a CPU list such as 2-5 or 2,4,6: {args.cpus}")
+            not_allowed = sorted(set(pinned) - os.sched_getaffinity(0))
+            if not_allowed:
+                ap.error(
+                    f"--cpus lists CPUs this process may not run on: {_format_cpu_list(not_allowed)} "
+                    f"(allowed: {_format_cpu_list(list(os.sched_getaffinity(0)))})"
+                )
+            if pinned:
+                cores = list(pinned)
+                # Compiles and input generation run on the remaining CPUs, away
+                # from the cores being measured.
+                housekeeping = set(os.sched_getaffinity(0)) - set(pinned)
+    jobs = args.jobs
+    if cores != [None] and jobs > len(cores):
+        print(f"warning: only {len(cores)} cores to pin to; using --jobs {len(cores)}", file=sys.stderr)
+        jobs = len(cores)
+    if cores == [None]:
+        cores = [None] * jobs
+
+    free_cores: queue.Queue[int | None] = queue.Queue()
+    for core in cores:
+        free_cores.put(core)
+
+    allocators: list[tuple[str, Path]] = []
+    if args.allocators:
+        allocators, missing = resolve_allocators(args.allocators)
+        if missing:
+            print(f"warning: allocators not found, skipping: {', '.join(missing)}", file=sys.stderr)
+    if args.alloc_count and not sys.platform.startswith("linux"):
+        print("warning: --alloc-count needs glibc; skipping", file=sys.stderr)
+        args.alloc_count = False
+    build_variants: list[str] = []
+    if args.build_variants:
+        try:
+            build_variants = parse_build_variants(args.build_variants)
+        except ValueError as e:
+            ap.error(str(e))
+    if args.launcher == "native" and args.pipe_input:
+        # The launcher rewinds one open file for every run; it has no pipe to feed.
+        ap.error("--launcher native reads its input from a file; it cannot be used with --pipe-input")
+    if args.memory and not hasattr(os, "wait4"):
+        print("warning: --memory needs wait4(2); skipping", file=sys.stderr)
+        args.memory = False
+
+    build_cache = None
+    if not args.no_build_cache:
+        build_cache = BuildCache(
+            args.build_cache or _default_build_cache_dir(), refresh=args.fresh_compile
+        )
 
     all_results: dict[str, list[BenchmarkResult]] = {}
 
     with tempfile.TemporaryDirectory(prefix="perf_compare_") as tmp:
         tmp_dir = Path(tmp)
 
-        for benchmark in benchmarks:
-            print(f"Running benchmark: {benchmark}...", file=sys.stderr)
+        input_cache = None
+        if not args.pipe_input:
+            input_cache = InputCache(
+                tmp_dir / "inputs" if args.no_input_cache
+                else args.input_cache or _default_input_cache_dir()
+            )
+
+        launcher = None
+        if args.launcher == "native":
+            try:
+                launcher = build_launcher(perf_repo_root, tmp_dir, build_cache)
+            except Exception as e:
+                print(f"warning: cannot build {LAUNCHER_SOURCE}, timing from Python: {e}",
+                      file=sys.stderr)
 
-            input_data = generate_input_data(benchmark, args.size)
+        alloc_counter = None
+        if args.alloc_count:
+            try:
+                alloc_counter = build_alloc_counter(perf_repo_root, tmp_dir, build_cache)
+            except Exception as e:
+                print(f"warning: cannot build {ALLOC_COUNT_SOURCE}: {e}", file=sys.stderr)
 
-            results = run_benchmark(
-                benchmark,
-                input_data,
-                x07_host_runner,
-                perf_repo_root,
-                tmp_dir,
-                iterations=args.iterations,
-                warmup=args.warmup,
-                direct_mode=args.direct,
-                x07_cc_profile=args.x07_cc_profile,
-            )
+        def run_one(key: str, benchmark: str, size_kb: int) -> list[BenchmarkResult]:
+            core = free_cores.get()
+            try:
+                if housekeeping:
+                    os.sched_setaffinity(0, housekeeping)
+                where = f" on CPU {core}" if core is not None else ""
+                print(f"Running benchmark: {key}{where}...", file=sys.stderr)
+
+                if input_cache is not None:
+                    input_data = input_cache.get(benchmark, size_kb, args.seed, args.generator)
+                else:
+                    input_data = generate_input_data(
+                        benchmark, size_kb, seed=args.seed, generator=args.generator
+                    )
+
+                return run_benchmark(
+                    benchmark,
+                    input_data,
+                    x07_host_runner,
+                    perf_repo_root,
+                    tmp_dir,
+                    iterations=args.iterations,
+                    warmup=args.warmup,
+                    direct_mode=args.direct,
+                    x07_cc_profile=args.x07_cc_profile,
+                    c_io=args.c_io,
+                    variants=variants,
+                    threads=threads,
+                    regex_backends=regex_backends,
+                    counters=args.counters,
+                    kernel_timing=args.kernel_timing,
+                    serve_requests=args.serve,
+                    memory=args.memory,
+                    launcher=launcher,
+                    core=core,
+                    build_cache=build_cache,
+                    target_ci=args.target_ci / 100,
+                    time_budget_s=args.time_budget,
+                    max_iterations=args.max_iterations,
+                    allocators=allocators,
+                    alloc_counter=alloc_counter,
+                    build_variants=build_variants,
+                    key=key,
+                )
+            finally:
+                free_cores.put(core)
+
+        with ThreadPoolExecutor(max_workers=jobs) as pool:
+            futures = {key: pool.submit(run_one, key, benchmark, size_kb)
+                       for key, benchmark, size_kb in runs}
+            for key, future in futures.items():
+                all_results[key] = future.result()
+
+    if build_cache is not None:
+        print(
+            f"Build cache: {build_cache.hits} reused, {build_cache.builds} built "
+            f"({build_cache.root})",
+            file=sys.stderr,
+        )
+    if input_cache is not None and not args.no_input_cache:
+        print(
+            f"Input cache: {input_cache.hits} reused, {input_cache.builds} generated "
+            f"({input_cache.root})",
+            file=sys.stderr,
+        )
 
-            all_results[benchmark] = results
+    fits = sweep_fits(all_results) if args.sweep else {}
+
+    snapshot = build_snapshot(all_results, args, x07_host_runner, fits, argv)
+    if args.output:
+        write_snapshot(snapshot, args.output, columnar=args.columnar)
+        print(f"Wrote snapshot: {args.output}", file=sys.stderr)
 
     if args.json:
-        output = {}
-        for benchmark, results in all_results.items():
-            output[benchmark] = [
-                {
-                    "language": r.language,
-                    "mean_time_ms": r.mean_time_ms,
-                    "min_time_ms": r.min_time_ms,
-                    "stddev_time_ms": r.stddev_time_ms,
-                    "compile_time_ms": r.compile_time_ms,
-                    "build_size_bytes": r.build_size_bytes,
-                    "peak_rss_kb": r.peak_rss_kb,
-                    "success": r.success,
-                    "error": r.error,
-                    "x07_cc_profile": args.x07_cc_profile if r.language == "X07" else None,
-                }
-                for r in results
-            ]
-        print(json.dumps(output, indent=2))
+        if args.columnar:
+            snapshot = dict(snapshot, results=_columnar(snapshot["results"]), layout="columnar")
+        print(json.dumps(snapshot, indent=2))
     else:
         print_results(
             all_results,
-            args.size,
+            f"sweep {args.sweep}" if args.sweep else f"{args.size} KB",
             direct_mode=args.direct,
             x07_cc_profile=args.x07_cc_profile,
         )
         print_summary_table(all_results)
+        print_stats_table(all_results)
+        print_scaling_table(all_results)
+        print_kernel_table(all_results)
+        print_pipeline_table(all_results)
+        print_host_table(all_results)
+        print_serve_table(all_results)
+        print_counters_table(all_results)
+        print_alloc_table(all_results)
+        print_memory_table(all_results)
+        print_sweep_table(fits)
 
     return 0
 
@@ -0,0 +1,77 @@
+//! Shared harness for the Rust benchmark programs (`mod bench;`).
+//!
+//! `run` reads all of stdin, times only the kernel call, and writes the
+//! kernel's output to stdout. With BENCH_KERNEL_TIMING set it reports the
+//! kernel time on stderr as "BENCH_KERNEL_NS <ns>", like c/bench.h. With
+//! BENCH_SERVE set it answers a stream of requests instead (see `serve`).
+//! The *_par programs use `thread_count` and `chunk_start` only.
+
+// Each program uses part of this module.
+#![allow(dead_code)]
+
+use std::io::{Read, Write};
+use std::time::Instant;
+
+pub fn run(kernel: fn(&[u8]) -> Vec<u8>) {
+    if std::env::var_os("BENCH_SERVE").is_some() {
+        serve(kernel);
+        return;
+    }
+
+    let mut input = Vec::new();
+    std::io::stdin().read_to_end(&mut input).unwrap();
+
+    let start = Instant::now();
+    let output = kernel(&input);
+    let elapsed = start.elapsed();
+
+    std::io::stdout().write_all(&output).unwrap();
+    report_kernel_ns(elapsed.as_nanos());
+}
+
+/// Request loop for server mode: each request and response is a u32 LE
+/// byte length followed by that many bytes (the X07 direct-binary ABI).
+fn serve(kernel: fn(&[u8]) -> Vec<u8>) {
+    let stdin = std::io::stdin();
+    let stdout = std::io::stdout();
+    let mut input = stdin.lock();
+    let mut output = stdout.lock();
+    let mut req = Vec::new();
+
+    loop {
+        let mut hdr = [0u8; 4];
+        match input.read_exact(&mut hdr) {
+            Ok(()) => {}
+            Err(ref e) if e.kind() == std::io::ErrorKind::UnexpectedEof => return,
+            Err(e) => panic!("{}", e),
+        }
+        req.resize(u32::from_le_bytes(hdr) as usize, 0);
+        input.read_exact(&mut req).unwrap();
+
+        let resp = kernel(&req);
+        output.write_all(&(resp.len() as u32).to_le_bytes()).unwrap();
+        output.write_all(&resp).unwrap();
+        output.flush().unwrap();
+    }
+}
+
+fn report_kernel_ns(ns: u128) {
+    if std::env::var_os("BENCH_KERNEL_TIMING").is_some() {
+        eprintln!("BENCH_KERNEL_NS {}", ns);
+    }
+}
+
+/// Worker count for the *_par programs from argv[1], clamped to [1, 256]
+/// like bench_thread_count in c/bench.h.
+pub fn thread_count() -> usize {
+    std::env::args()
+        .nth(1)
+        .and_then(|s| s.parse::<usize>().ok())
+        .unwrap_or(1)
+        .clamp(1, 256)
+}
+
+/// Start offset of chunk k when splitting len bytes into n nearly equal chunks.
+pub fn chunk_start(len: usize, n: usize, k: usize) -> usize {
+    (len / n) * k + (len % n) * k / n
+}
@@ -0,0 +1,20 @@
+// The byte_freq kernel, shared by rust/byte_freq.rs and rust_cargo/pipeline.
+
+pub fn kernel(input: &[u8]) -> Vec<u8> {
+    let mut freq = [0u32; 256];
+
+    for &b in input {
+        freq[b as usize] += 1;
+    }
+
+    let mut output = Vec::with_capacity(256 * 5);
+
+    for (j, &count) in freq.iter().enumerate() {
+        if count > 0 {
+            output.push(j as u8);
+            output.extend_from_slice(&count.to_le_bytes());
+        }
+    }
+
+    output
+}
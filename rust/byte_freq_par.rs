@@ -0,0 +1,42 @@
+mod bench;
+
+use std::io::{Read, Write};
+
+fn main() {
+    let threads = bench::thread_count();
+
+    let mut input = Vec::new();
+    std::io::stdin().read_to_end(&mut input).unwrap();
+
+    let mut freq = [0u32; 256];
+    std::thread::scope(|s| {
+        let handles: Vec<_> = (0..threads)
+            .map(|k| {
+                let chunk = &input[bench::chunk_start(input.len(), threads, k)..bench::chunk_start(input.len(), threads, k + 1)];
+                s.spawn(move || {
+                    let mut local = [0u32; 256];
+                    for &b in chunk {
+                        local[b as usize] += 1;
+                    }
+                    local
+                })
+            })
+            .collect();
+        for h in handles {
+            for (total, n) in freq.iter_mut().zip(h.join().unwrap()) {
+                *total += n;
+            }
+        }
+    });
+
+    let mut output = Vec::with_capacity(256 * 5);
+
+    for (j, &count) in freq.iter().enumerate() {
+        if count > 0 {
+            output.push(j as u8);
+            output.extend_from_slice(&count.to_le_bytes());
+        }
+    }
+
+    std::io::stdout().write_all(&output).unwrap();
+}
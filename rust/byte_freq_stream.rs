@@ -0,0 +1,32 @@
+use std::io::{ErrorKind, Read, Write};
+
+const CHUNK: usize = 64 * 1024;
+
+fn main() {
+    let mut stdin = std::io::stdin().lock();
+    let mut buf = vec![0u8; CHUNK];
+    let mut freq = [0u32; 256];
+
+    loop {
+        let n = match stdin.read(&mut buf) {
+            Ok(0) => break,
+            Ok(n) => n,
+            Err(e) if e.kind() == ErrorKind::Interrupted => continue,
+            Err(e) => panic!("{}", e),
+        };
+        for &b in &buf[..n] {
+            freq[b as usize] += 1;
+        }
+    }
+
+    let mut output = Vec::with_capacity(256 * 5);
+
+    for (j, &count) in freq.iter().enumerate() {
+        if count > 0 {
+            output.push(j as u8);
+            output.extend_from_slice(&count.to_le_bytes());
+        }
+    }
+
+    std::io::stdout().write_all(&output).unwrap();
+}
@@ -0,0 +1,83 @@
+mod bench;
+
+// Little-endian base 2^32 limbs with no leading zero limbs, as in
+// c/fib_big.c.
+
+fn trim(x: &mut Vec<u32>) {
+    while x.last() == Some(&0) {
+        x.pop();
+    }
+}
+
+fn add(x: &[u32], y: &[u32]) -> Vec<u32> {
+    let n = x.len().max(y.len());
+    let mut r = Vec::with_capacity(n + 1);
+    let mut carry = 0u64;
+    for i in 0..n {
+        let s = carry + *x.get(i).unwrap_or(&0) as u64 + *y.get(i).unwrap_or(&0) as u64;
+        r.push(s as u32);
+        carry = s >> 32;
+    }
+    r.push(carry as u32);
+    trim(&mut r);
+    r
+}
+
+// x - y for x >= y.
+fn sub(x: &[u32], y: &[u32]) -> Vec<u32> {
+    let mut r = Vec::with_capacity(x.len());
+    let mut borrow = 0u64;
+    for (i, &xi) in x.iter().enumerate() {
+        let s = (xi as u64)
+            .wrapping_sub(*y.get(i).unwrap_or(&0) as u64)
+            .wrapping_sub(borrow);
+        r.push(s as u32);
+        borrow = s >> 63;
+    }
+    trim(&mut r);
+    r
+}
+
+fn mul(x: &[u32], y: &[u32]) -> Vec<u32> {
+    let mut r = vec![0u32; x.len() + y.len()];
+    for (i, &xi) in x.iter().enumerate() {
+        let mut carry = 0u64;
+        for (j, &yj) in y.iter().enumerate() {
+            let t = r[i + j] as u64 + xi as u64 * yj as u64 + carry;
+            r[i + j] = t as u32;
+            carry = t >> 32;
+        }
+        r[i + y.len()] = carry as u32;
+    }
+    trim(&mut r);
+    r
+}
+
+fn kernel(input: &[u8]) -> Vec<u8> {
+    let n = u32::from_le_bytes([input[0], input[1], input[2], input[3]]);
+
+    // Fast doubling with (a, b) = (F(k), F(k+1)); see c/fib_big.c.
+    let mut a: Vec<u32> = Vec::new();
+    let mut b: Vec<u32> = vec![1];
+    for bit in (0..32).rev() {
+        let c = mul(&a, &sub(&add(&b, &b), &a));
+        let d = add(&mul(&a, &a), &mul(&b, &b));
+        if (n >> bit) & 1 == 1 {
+            b = add(&c, &d);
+            a = d;
+        } else {
+            a = c;
+            b = d;
+        }
+    }
+
+    let mut output: Vec<u8> = a.iter().flat_map(|limb| limb.to_le_bytes()).collect();
+    while output.last() == Some(&0) {
+        output.pop();
+    }
+    output
+}
+
+fn main() {
+    bench::run(kernel);
+}
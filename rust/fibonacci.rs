@@ -1,9 +1,7 @@
-use std::io::{Read, Write};
+mod bench;
 
-fn main() {
-    let mut buf = [0u8; 4];
-    std::io::stdin().read_exact(&mut buf).unwrap();
-    let n = u32::from_le_bytes(buf);
+fn kernel(input: &[u8]) -> Vec<u8> {
+    let n = u32::from_le_bytes([input[0], input[1], input[2], input[3]]);
 
     let result = if n < 2 {
         n
@@ -18,5 +16,9 @@ fn main() {
         b
     };
 
-    std::io::stdout().write_all(&result.to_le_bytes()).unwrap();
+    result.to_le_bytes().to_vec()
+}
+
+fn main() {
+    bench::run(kernel);
 }
@@ -0,0 +1,60 @@
+mod bench;
+
+const STEPS: usize = 16;
+
+#[derive(Clone, Copy)]
+#[allow(dead_code)]
+struct Particle {
+    x: u32,
+    y: u32,
+    z: u32,
+    vx: u32,
+    vy: u32,
+    vz: u32,
+    mass: u32,
+    id: u32,
+}
+
+fn kernel(input: &[u8]) -> Vec<u8> {
+    let field = |r: &[u8], f: usize| u32::from_le_bytes([r[4 * f], r[4 * f + 1], r[4 * f + 2], r[4 * f + 3]]);
+    let mut particles: Vec<Particle> = input
+        .chunks_exact(32)
+        .map(|r| Particle {
+            x: field(r, 0),
+            y: field(r, 1),
+            z: field(r, 2),
+            vx: field(r, 3),
+            vy: field(r, 4),
+            vz: field(r, 5),
+            mass: field(r, 6),
+            id: field(r, 7),
+        })
+        .collect();
+
+    for _ in 0..STEPS {
+        for p in particles.iter_mut() {
+            p.x = p.x.wrapping_add(p.vx);
+            p.y = p.y.wrapping_add(p.vy);
+            p.z = p.z.wrapping_add(p.vz);
+        }
+    }
+
+    let mut mass: u32 = 0;
+    let mut pos: u32 = 0;
+    for p in &particles {
+        if p.x < p.y {
+            mass = mass.wrapping_add(p.mass);
+        }
+        pos = pos.wrapping_add(p.x.wrapping_add(p.y).wrapping_add(p.z));
+    }
+
+    let mut output = Vec::with_capacity(12);
+    output.extend_from_slice(&(particles.len() as u32).to_le_bytes());
+    output.extend_from_slice(&mass.to_le_bytes());
+    output.extend_from_slice(&pos.to_le_bytes());
+    output
+}
+
+fn main() {
+    bench::run(kernel);
+}
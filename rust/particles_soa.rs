@@ -0,0 +1,49 @@
+mod bench;
+
+const STEPS: usize = 16;
+
+// One vector per record field, in input order (x, y, z, vx, vy, vz, mass, id).
+fn kernel(input: &[u8]) -> Vec<u8> {
+    let n = input.len() / 32;
+    let field = |r: &[u8], f: usize| u32::from_le_bytes([r[4 * f], r[4 * f + 1], r[4 * f + 2], r[4 * f + 3]]);
+    let (mut x, mut y, mut z) = (Vec::with_capacity(n), Vec::with_capacity(n), Vec::with_capacity(n));
+    let (mut vx, mut vy, mut vz) = (Vec::with_capacity(n), Vec::with_capacity(n), Vec::with_capacity(n));
+    let (mut m, mut id) = (Vec::with_capacity(n), Vec::with_capacity(n));
+    for r in input.chunks_exact(32) {
+        x.push(field(r, 0));
+        y.push(field(r, 1));
+        z.push(field(r, 2));
+        vx.push(field(r, 3));
+        vy.push(field(r, 4));
+        vz.push(field(r, 5));
+        m.push(field(r, 6));
+        id.push(field(r, 7));
+    }
+
+    for _ in 0..STEPS {
+        for i in 0..n {
+            x[i] = x[i].wrapping_add(vx[i]);
+            y[i] = y[i].wrapping_add(vy[i]);
+            z[i] = z[i].wrapping_add(vz[i]);
+        }
+    }
+
+    let mut mass: u32 = 0;
+    let mut pos: u32 = 0;
+    for i in 0..n {
+        if x[i] < y[i] {
+            mass = mass.wrapping_add(m[i]);
+        }
+        pos = pos.wrapping_add(x[i].wrapping_add(y[i]).wrapping_add(z[i]));
+    }
+
+    let mut output = Vec::with_capacity(12);
+    output.extend_from_slice(&(n as u32).to_le_bytes());
+    output.extend_from_slice(&mass.to_le_bytes());
+    output.extend_from_slice(&pos.to_le_bytes());
+    output
+}
+
+fn main() {
+    bench::run(kernel);
+}
@@ -0,0 +1,17 @@
+mod bench;
+
+fn kernel(input: &[u8]) -> Vec<u8> {
+    let total: usize = input.chunks_exact(2).map(|pair| pair[0] as usize).sum();
+    let mut output = Vec::with_capacity(total);
+
+    for pair in input.chunks_exact(2) {
+        let (cnt, b) = (pair[0] as usize, pair[1]);
+        output.resize(output.len() + cnt, b);
+    }
+
+    output
+}
+
+fn main() {
+    bench::run(kernel);
+}
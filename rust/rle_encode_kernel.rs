@@ -0,0 +1,33 @@
+// The rle_encode kernel, shared by rust/rle_encode.rs and rust_cargo/pipeline.
+
+pub fn kernel(input: &[u8]) -> Vec<u8> {
+    if input.is_empty() {
+        return Vec::new();
+    }
+
+    let mut output = Vec::with_capacity(input.len() * 2);
+    let mut cur = input[0];
+    let mut cnt: u8 = 1;
+
+    for &x in &input[1..] {
+        if x == cur {
+            if cnt < 255 {
+                cnt += 1;
+            } else {
+                output.push(cnt);
+                output.push(cur);
+                cnt = 1;
+            }
+        } else {
+            output.push(cnt);
+            output.push(cur);
+            cur = x;
+            cnt = 1;
+        }
+    }
+
+    output.push(cnt);
+    output.push(cur);
+
+    output
+}
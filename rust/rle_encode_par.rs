@@ -0,0 +1,69 @@
+mod bench;
+
+use std::io::{Read, Write};
+
+fn encode(input: &[u8]) -> Vec<u8> {
+    let mut output = Vec::with_capacity(input.len() * 2);
+    let Some((&first, rest)) = input.split_first() else {
+        return output;
+    };
+    let mut cur = first;
+    let mut cnt: u8 = 1;
+
+    for &x in rest {
+        if x == cur {
+            if cnt < 255 {
+                cnt += 1;
+            } else {
+                output.push(cnt);
+                output.push(cur);
+                cnt = 1;
+            }
+        } else {
+            output.push(cnt);
+            output.push(cur);
+            cur = x;
+            cnt = 1;
+        }
+    }
+
+    output.push(cnt);
+    output.push(cur);
+    output
+}
+
+fn main() {
+    let threads = bench::thread_count();
+
+    let mut input = Vec::new();
+    std::io::stdin().read_to_end(&mut input).unwrap();
+    let len = input.len();
+
+    // Chunk edges are pushed forward to the next run boundary, so every chunk
+    // encodes independently and the concatenation matches the serial output.
+    let mut bounds = vec![0usize; threads + 1];
+    for k in 1..threads {
+        let mut b = bench::chunk_start(len, threads, k).max(bounds[k - 1]);
+        while b > 0 && b < len && input[b] == input[b - 1] {
+            b += 1;
+        }
+        bounds[k] = b;
+    }
+    bounds[threads] = len;
+
+    let parts: Vec<Vec<u8>> = std::thread::scope(|s| {
+        let handles: Vec<_> = bounds
+            .windows(2)
+            .map(|w| {
+                let chunk = &input[w[0]..w[1]];
+                s.spawn(move || encode(chunk))
+            })
+            .collect();
+        handles.into_iter().map(|h| h.join().unwrap()).collect()
+    });
+
+    let mut stdout = std::io::stdout().lock();
+    for part in &parts {
+        stdout.write_all(part).unwrap();
+    }
+}
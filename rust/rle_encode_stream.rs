@@ -0,0 +1,52 @@
+use std::io::{ErrorKind, Read, Write};
+
+const CHUNK: usize = 64 * 1024;
+
+fn main() {
+    let mut stdin = std::io::stdin().lock();
+    let mut stdout = std::io::stdout().lock();
+    let mut buf = vec![0u8; CHUNK];
+    let mut output = Vec::with_capacity(CHUNK * 2);
+
+    // The open run is carried across chunk edges and only emitted once it ends.
+    let mut run: Option<(u8, u8)> = None;
+
+    loop {
+        let n = match stdin.read(&mut buf) {
+            Ok(0) => break,
+            Ok(n) => n,
+            Err(e) if e.kind() == ErrorKind::Interrupted => continue,
+            Err(e) => panic!("{}", e),
+        };
+
+        let (mut cur, mut cnt, rest) = match run {
+            Some((cur, cnt)) => (cur, cnt, &buf[..n]),
+            None => (buf[0], 1, &buf[1..n]),
+        };
+
+        for &x in rest {
+            if x == cur {
+                if cnt < 255 {
+                    cnt += 1;
+                } else {
+                    output.push(cnt);
+                    output.push(cur);
+                    cnt = 1;
+                }
+            } else {
+                output.push(cnt);
+                output.push(cur);
+                cur = x;
+                cnt = 1;
+            }
+        }
+
+        run = Some((cur, cnt));
+        stdout.write_all(&output).unwrap();
+        output.clear();
+    }
+
+    if let Some((cur, cnt)) = run {
+        stdout.write_all(&[cnt, cur]).unwrap();
+    }
+}
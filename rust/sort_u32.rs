@@ -0,0 +1,23 @@
+mod bench;
+
+fn kernel(input: &[u8]) -> Vec<u8> {
+    let mut values: Vec<u32> = input
+        .chunks_exact(4)
+        .map(|c| u32::from_le_bytes([c[0], c[1], c[2], c[3]]))
+        .collect();
+    values.sort_unstable();
+
+    let mut sum: u32 = 0;
+    for (i, &v) in values.iter().enumerate() {
+        sum = sum.wrapping_add((i as u32).wrapping_add(1).wrapping_mul(v));
+    }
+
+    let mut output = Vec::with_capacity(8);
+    output.extend_from_slice(&(values.len() as u32).to_le_bytes());
+    output.extend_from_slice(&sum.to_le_bytes());
+    output
+}
+
+fn main() {
+    bench::run(kernel);
+}
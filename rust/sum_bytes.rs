@@ -1,10 +1,11 @@
-use std::io::{Read, Write};
-
-fn main() {
-    let mut input = Vec::new();
-    std::io::stdin().read_to_end(&mut input).unwrap();
+mod bench;
 
+fn kernel(input: &[u8]) -> Vec<u8> {
     let acc: u32 = input.iter().map(|&b| b as u32).sum();
 
-    std::io::stdout().write_all(&acc.to_le_bytes()).unwrap();
+    acc.to_le_bytes().to_vec()
+}
+
+fn main() {
+    bench::run(kernel);
 }
@@ -0,0 +1,24 @@
+mod bench;
+
+use std::io::{Read, Write};
+
+fn main() {
+    let threads = bench::thread_count();
+
+    let mut input = Vec::new();
+    std::io::stdin().read_to_end(&mut input).unwrap();
+
+    let acc = std::thread::scope(|s| {
+        let handles: Vec<_> = (0..threads)
+            .map(|k| {
+                let chunk = &input[bench::chunk_start(input.len(), threads, k)..bench::chunk_start(input.len(), threads, k + 1)];
+                s.spawn(move || chunk.iter().fold(0u32, |a, &b| a.wrapping_add(b as u32)))
+            })
+            .collect();
+        handles
+            .into_iter()
+            .fold(0u32, |a, h| a.wrapping_add(h.join().unwrap()))
+    });
+
+    std::io::stdout().write_all(&acc.to_le_bytes()).unwrap();
+}
@@ -0,0 +1,21 @@
+use std::io::{ErrorKind, Read, Write};
+
+const CHUNK: usize = 64 * 1024;
+
+fn main() {
+    let mut stdin = std::io::stdin().lock();
+    let mut buf = vec![0u8; CHUNK];
+    let mut acc: u32 = 0;
+
+    loop {
+        let n = match stdin.read(&mut buf) {
+            Ok(0) => break,
+            Ok(n) => n,
+            Err(e) if e.kind() == ErrorKind::Interrupted => continue,
+            Err(e) => panic!("{}", e),
+        };
+        acc = buf[..n].iter().fold(acc, |a, &b| a.wrapping_add(b as u32));
+    }
+
+    std::io::stdout().write_all(&acc.to_le_bytes()).unwrap();
+}
@@ -1,13 +1,10 @@
-use std::io::{Read, Write};
-
-fn main() {
-    let mut input = Vec::new();
-    std::io::stdin().read_to_end(&mut input).unwrap();
+mod bench;
 
+fn kernel(input: &[u8]) -> Vec<u8> {
     let mut cnt: u32 = 0;
     let mut in_word = false;
 
-    for &c in &input {
+    for &c in input {
         let is_space = c == 32 || c == 10 || c == 13 || c == 9;
         if is_space {
             in_word = false;
@@ -17,5 +14,9 @@ fn main() {
         }
     }
 
-    std::io::stdout().write_all(&cnt.to_le_bytes()).unwrap();
+    cnt.to_le_bytes().to_vec()
+}
+
+fn main() {
+    bench::run(kernel);
 }
@@ -0,0 +1,44 @@
+mod bench;
+
+use std::io::{Read, Write};
+
+fn is_space(c: u8) -> bool {
+    c == 32 || c == 10 || c == 13 || c == 9
+}
+
+// Counts word starts in [start, end); the byte before start decides the first one.
+fn count_words(input: &[u8], start: usize, end: usize) -> u32 {
+    let mut cnt: u32 = 0;
+    let mut in_word = start > 0 && !is_space(input[start - 1]);
+
+    for &c in &input[start..end] {
+        if is_space(c) {
+            in_word = false;
+        } else if !in_word {
+            cnt += 1;
+            in_word = true;
+        }
+    }
+    cnt
+}
+
+fn main() {
+    let threads = bench::thread_count();
+
+    let mut input = Vec::new();
+    std::io::stdin().read_to_end(&mut input).unwrap();
+
+    let cnt: u32 = std::thread::scope(|s| {
+        let input = &input;
+        let handles: Vec<_> = (0..threads)
+            .map(|k| {
+                let start = bench::chunk_start(input.len(), threads, k);
+                let end = bench::chunk_start(input.len(), threads, k + 1);
+                s.spawn(move || count_words(input, start, end))
+            })
+            .collect();
+        handles.into_iter().map(|h| h.join().unwrap()).sum()
+    });
+
+    std::io::stdout().write_all(&cnt.to_le_bytes()).unwrap();
+}
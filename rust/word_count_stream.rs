@@ -0,0 +1,31 @@
+use std::io::{ErrorKind, Read, Write};
+
+const CHUNK: usize = 64 * 1024;
+
+fn main() {
+    let mut stdin = std::io::stdin().lock();
+    let mut buf = vec![0u8; CHUNK];
+    let mut cnt: u32 = 0;
+    // Carried across chunks so a word split by a chunk edge counts once.
+    let mut in_word = false;
+
+    loop {
+        let n = match stdin.read(&mut buf) {
+            Ok(0) => break,
+            Ok(n) => n,
+            Err(e) if e.kind() == ErrorKind::Interrupted => continue,
+            Err(e) => panic!("{}", e),
+        };
+        for &c in &buf[..n] {
+            let is_space = c == 32 || c == 10 || c == 13 || c == 9;
+            if is_space {
+                in_word = false;
+            } else if !in_word {
+                cnt += 1;
+                in_word = true;
+            }
+        }
+    }
+
+    std::io::stdout().write_all(&cnt.to_le_bytes()).unwrap();
+}
@@ -0,0 +1,32 @@
+mod bench;
+
+// 1 for the bytes word_count.rs treats as whitespace.
+static SPACE_TABLE: [u8; 256] = space_table();
+
+const fn space_table() -> [u8; 256] {
+    let mut table = [0u8; 256];
+    table[9] = 1;
+    table[10] = 1;
+    table[13] = 1;
+    table[32] = 1;
+    table
+}
+
+// Branchless word_count, as in c/word_count_table.c: each byte adds
+// prev_space & !space, with the class read from a 256-entry table.
+fn kernel(input: &[u8]) -> Vec<u8> {
+    let mut cnt: u32 = 0;
+    let mut prev_space: u32 = 1;
+
+    for &c in input {
+        let space = SPACE_TABLE[c as usize] as u32;
+        cnt += prev_space & (space ^ 1);
+        prev_space = space;
+    }
+
+    cnt.to_le_bytes().to_vec()
+}
+
+fn main() {
+    bench::run(kernel);
+}
@@ -0,0 +1,24 @@
+mod bench;
+
+fn kernel(input: &[u8]) -> Vec<u8> {
+    // Borrows when the input is valid UTF-8; invalid bytes become U+FFFD,
+    // which is not whitespace, like the other implementations.
+    let text = String::from_utf8_lossy(input);
+    let mut cnt: u32 = 0;
+    let mut in_word = false;
+
+    for c in text.chars() {
+        if c.is_whitespace() {
+            in_word = false;
+        } else if !in_word {
+            cnt += 1;
+            in_word = true;
+        }
+    }
+
+    cnt.to_le_bytes().to_vec()
+}
+
+fn main() {
+    bench::run(kernel);
+}
@@ -0,0 +1,33 @@
+mod bench;
+
+use std::collections::HashMap;
+
+const TOP_K: usize = 10;
+
+fn is_space(b: &u8) -> bool {
+    matches!(*b, b' ' | b'\n' | b'\r' | b'\t')
+}
+
+// Output format as in c/word_freq.c.
+fn kernel(input: &[u8]) -> Vec<u8> {
+    let mut counts: HashMap<&[u8], u32> = HashMap::new();
+    for word in input.split(is_space).filter(|w| !w.is_empty()) {
+        *counts.entry(word).or_insert(0) += 1;
+    }
+
+    let mut entries: Vec<(&[u8], u32)> = counts.into_iter().collect();
+    entries.sort_unstable_by(|a, b| b.1.cmp(&a.1).then(a.0.cmp(b.0)));
+
+    let mut output = Vec::new();
+    output.extend_from_slice(&(entries.len() as u32).to_le_bytes());
+    for (word, count) in entries.iter().take(TOP_K) {
+        output.extend_from_slice(&count.to_le_bytes());
+        output.extend_from_slice(&(word.len() as u32).to_le_bytes());
+        output.extend_from_slice(word);
+    }
+    output
+}
+
+fn main() {
+    bench::run(kernel);
+}
@@ -0,0 +1,19 @@
+#[path = "../../../rust/bench.rs"]
+mod bench;
+#[path = "../../../rust/byte_freq_kernel.rs"]
+mod byte_freq;
+#[path = "../../regex_replace/src/kernel.rs"]
+mod regex_replace;
+#[path = "../../../rust/rle_encode_kernel.rs"]
+mod rle_encode;
+
+// Fused pipeline: regex_replace, then rle_encode, then byte_freq, in one
+// process. Each stage is the kernel its own program runs, from the shared
+// kernel modules (see c/pipeline.c).
+fn kernel(input: &[u8]) -> Vec<u8> {
+    byte_freq::kernel(&rle_encode::kernel(&regex_replace::kernel(input)))
+}
+
+fn main() {
+    bench::run(kernel);
+}
@@ -1,40 +1,29 @@
-use std::io::{Read, Write};
+#[path = "../../../rust/bench.rs"]
+mod bench;
+
 use regex::Regex;
 
-fn main() {
-    let mut input = Vec::new();
-    std::io::stdin().read_to_end(&mut input).unwrap();
+fn kernel(input: &[u8]) -> Vec<u8> {
+    let zero = 0u32.to_le_bytes().to_vec();
 
     if input.len() < 4 {
-        let result: u32 = 0;
-        std::io::stdout().write_all(&result.to_le_bytes()).unwrap();
-        return;
+        return zero;
     }
 
     let pat_len = u32::from_le_bytes([input[0], input[1], input[2], input[3]]) as usize;
 
     if 4 + pat_len > input.len() {
-        let result: u32 = 0;
-        std::io::stdout().write_all(&result.to_le_bytes()).unwrap();
-        return;
+        return zero;
     }
 
     let pattern = match std::str::from_utf8(&input[4..4 + pat_len]) {
         Ok(s) => s,
-        Err(_) => {
-            let result: u32 = 0;
-            std::io::stdout().write_all(&result.to_le_bytes()).unwrap();
-            return;
-        }
+        Err(_) => return zero,
     };
 
     let text = match std::str::from_utf8(&input[4 + pat_len..]) {
         Ok(s) => s,
-        Err(_) => {
-            let result: u32 = 0;
-            std::io::stdout().write_all(&result.to_le_bytes()).unwrap();
-            return;
-        }
+        Err(_) => return zero,
     };
 
     let count: u32 = match Regex::new(pattern) {
@@ -42,5 +31,9 @@ fn main() {
         Err(_) => 0,
     };
 
-    std::io::stdout().write_all(&count.to_le_bytes()).unwrap();
+    count.to_le_bytes().to_vec()
+}
+
+fn main() {
+    bench::run(kernel);
 }
@@ -0,0 +1,45 @@
+// The regex_replace kernel, shared by this crate's main.rs and
+// rust_cargo/pipeline.
+
+use regex::Regex;
+
+pub fn kernel(input: &[u8]) -> Vec<u8> {
+    if input.len() < 8 {
+        return input.to_vec();
+    }
+
+    let pat_len = u32::from_le_bytes([input[0], input[1], input[2], input[3]]) as usize;
+    let repl_len = u32::from_le_bytes([input[4], input[5], input[6], input[7]]) as usize;
+
+    if 8 + pat_len + repl_len > input.len() {
+        let text_start = 8 + pat_len + repl_len;
+        if text_start <= input.len() {
+            return input[text_start..].to_vec();
+        }
+        return Vec::new();
+    }
+
+    let raw_text = &input[8 + pat_len + repl_len..];
+
+    let pattern = match std::str::from_utf8(&input[8..8 + pat_len]) {
+        Ok(s) => s,
+        Err(_) => return raw_text.to_vec(),
+    };
+
+    let replacement = match std::str::from_utf8(&input[8 + pat_len..8 + pat_len + repl_len]) {
+        Ok(s) => s,
+        Err(_) => return raw_text.to_vec(),
+    };
+
+    let text = match std::str::from_utf8(raw_text) {
+        Ok(s) => s,
+        Err(_) => return raw_text.to_vec(),
+    };
+
+    let result = match Regex::new(pattern) {
+        Ok(re) => re.replace_all(text, replacement).into_owned(),
+        Err(_) => text.to_string(),
+    };
+
+    result.into_bytes()
+}
@@ -0,0 +1,128 @@
+/*
+ * Allocation-counting interposer for run_benchmarks.py --alloc-count.
+ *
+ * Built as a shared object and loaded with LD_PRELOAD. It wraps the glibc
+ * allocator entry points, forwarding to the __libc_* implementations, and
+ * at exit writes one line to stderr:
+ *
+ *   BENCH_ALLOC mallocs=N frees=N reallocs=N realloc_moves=N
+ *               realloc_copy_bytes=N bytes=N peak_bytes=N
+ *
+ * `bytes` is the total requested (malloc/calloc/realloc growth), and
+ * `peak_bytes` is the high-water mark of live usable bytes. A realloc that
+ * returns a different pointer counts as a move that copied the old block.
+ * Counters are atomic, so the *_par programs are counted correctly.
+ *
+ * glibc only: other libcs do not export the __libc_* entry points.
+ */
+#define _GNU_SOURCE
+#include <errno.h>
+#include <malloc.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t n, size_t size);
+extern void *__libc_realloc(void *p, size_t size);
+extern void *__libc_memalign(size_t align, size_t size);
+extern void __libc_free(void *p);
+
+static uint64_t n_mallocs, n_frees, n_reallocs, n_moves;
+static uint64_t copy_bytes, req_bytes;
+static int64_t live_bytes, peak_bytes;
+
+#define ADD(var, v) __atomic_add_fetch(&(var), (v), __ATOMIC_RELAXED)
+
+static void track_alloc(void *p, size_t requested) {
+    if (!p) return;
+    ADD(n_mallocs, 1);
+    ADD(req_bytes, requested);
+    int64_t live = ADD(live_bytes, (int64_t)malloc_usable_size(p));
+    int64_t peak = __atomic_load_n(&peak_bytes, __ATOMIC_RELAXED);
+    while (live > peak &&
+           !__atomic_compare_exchange_n(&peak_bytes, &peak, live, 1, __ATOMIC_RELAXED,
+                                        __ATOMIC_RELAXED)) {
+    }
+}
+
+static void track_free(void *p) {
+    if (!p) return;
+    ADD(n_frees, 1);
+    ADD(live_bytes, -(int64_t)malloc_usable_size(p));
+}
+
+void *malloc(size_t size) {
+    void *p = __libc_malloc(size);
+    track_alloc(p, size);
+    return p;
+}
+
+void *calloc(size_t n, size_t size) {
+    void *p = __libc_calloc(n, size);
+    track_alloc(p, n * size);
+    return p;
+}
+
+void *realloc(void *old, size_t size) {
+    if (!old) return malloc(size);
+    if (size == 0) {
+        free(old);
+        return NULL;
+    }
+    size_t old_usable = malloc_usable_size(old);
+    void *p = __libc_realloc(old, size);
+    if (!p) return NULL;
+    ADD(n_reallocs, 1);
+    if (size > old_usable) ADD(req_bytes, size - old_usable);
+    if (p != old) {
+        ADD(n_moves, 1);
+        ADD(copy_bytes, old_usable < size ? old_usable : size);
+    }
+    ADD(live_bytes, (int64_t)malloc_usable_size(p) - (int64_t)old_usable);
+    int64_t live = __atomic_load_n(&live_bytes, __ATOMIC_RELAXED);
+    int64_t peak = __atomic_load_n(&peak_bytes, __ATOMIC_RELAXED);
+    while (live > peak &&
+           !__atomic_compare_exchange_n(&peak_bytes, &peak, live, 1, __ATOMIC_RELAXED,
+                                        __ATOMIC_RELAXED)) {
+    }
+    return p;
+}
+
+void free(void *p) {
+    track_free(p);
+    __libc_free(p);
+}
+
+void *memalign(size_t align, size_t size) {
+    void *p = __libc_memalign(align, size);
+    track_alloc(p, size);
+    return p;
+}
+
+void *aligned_alloc(size_t align, size_t size) { return memalign(align, size); }
+
+int posix_memalign(void **out, size_t align, size_t size) {
+    void *p = memalign(align, size);
+    if (!p) return ENOMEM;
+    *out = p;
+    return 0;
+}
+
+/* Uses write(2) and a stack buffer so reporting does not allocate. */
+__attribute__((destructor)) static void report(void) {
+    char line[256];
+    int n = snprintf(line, sizeof line,
+                     "BENCH_ALLOC mallocs=%llu frees=%llu reallocs=%llu realloc_moves=%llu "
+                     "realloc_copy_bytes=%llu bytes=%llu peak_bytes=%lld\n",
+                     (unsigned long long)n_mallocs, (unsigned long long)n_frees,
+                     (unsigned long long)n_reallocs, (unsigned long long)n_moves,
+                     (unsigned long long)copy_bytes, (unsigned long long)req_bytes,
+                     (long long)peak_bytes);
+    if (n > 0) {
+        ssize_t unused = write(STDERR_FILENO, line, (size_t)n < sizeof line ? (size_t)n : sizeof line);
+        (void)unused;
+    }
+}
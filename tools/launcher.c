@@ -0,0 +1,164 @@
+/*
+ * Low-overhead launcher for run_benchmarks.py --launcher native.
+ *
+ *   launcher -i INPUT -o OUTPUT [-w WARMUP] [-n RUNS] -- PROGRAM [ARGS...]
+ *
+ * Runs PROGRAM WARMUP + RUNS times, one after another. Every run gets the
+ * pre-opened INPUT file as its stdin, rewound to the start, and its stdout
+ * is drained into one buffer that is reused across runs. The runs share
+ * the launcher's environment and stderr. After each timed run it writes
+ * one line to stdout:
+ *
+ *   BENCH_LAUNCH wall_ns=N user_ns=N sys_ns=N minflt=N majflt=N
+ *
+ * Wall time runs from just before posix_spawn to the exit reaped by
+ * wait4. The rest of the line is the run's rusage. The last run's output
+ * is written to OUTPUT. A run that fails stops the batch with exit
+ * status 2.
+ *
+ * ru_maxrss is not reported. On Linux a spawned child's peak starts from
+ * its parent's, which here includes the output buffer.
+ */
+#define _GNU_SOURCE
+#include <errno.h>
+#include <fcntl.h>
+#include <spawn.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+extern char **environ;
+
+static uint8_t *buf;
+static size_t buf_cap, buf_len;
+
+static int64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static int64_t tv_ns(struct timeval tv) {
+    return (int64_t)tv.tv_sec * 1000000000 + (int64_t)tv.tv_usec * 1000;
+}
+
+static int cloexec(int fd) { return fcntl(fd, F_SETFD, FD_CLOEXEC); }
+
+/* Reads `fd` to EOF into buf. The buffer only grows, so after the first run it is already mapped. */
+static int drain(int fd) {
+    buf_len = 0;
+    for (;;) {
+        if (buf_len == buf_cap) {
+            size_t cap = buf_cap ? buf_cap * 2 : 1 << 20;
+            uint8_t *grown = realloc(buf, cap);
+            if (!grown) return -1;
+            memset(grown + buf_cap, 0, cap - buf_cap);
+            buf = grown;
+            buf_cap = cap;
+        }
+        ssize_t n = read(fd, buf + buf_len, buf_cap - buf_len);
+        if (n == 0) return 0;
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return -1;
+        }
+        buf_len += (size_t)n;
+    }
+}
+
+/* One run of argv; fills in the wall time and rusage, returns the wait status or -1. */
+static int run_once(char **argv, int in_fd, int64_t *wall_ns, struct rusage *ru) {
+    int pipefd[2];
+    if (lseek(in_fd, 0, SEEK_SET) != 0 || pipe(pipefd) != 0) return -1;
+    cloexec(pipefd[0]);
+    cloexec(pipefd[1]);
+
+    posix_spawn_file_actions_t fa;
+    posix_spawn_file_actions_init(&fa);
+    posix_spawn_file_actions_adddup2(&fa, in_fd, STDIN_FILENO);
+    posix_spawn_file_actions_adddup2(&fa, pipefd[1], STDOUT_FILENO);
+
+    int64_t start = now_ns();
+    pid_t pid;
+    int rc = posix_spawn(&pid, argv[0], &fa, NULL, argv, environ);
+    posix_spawn_file_actions_destroy(&fa);
+    close(pipefd[1]);
+    if (rc != 0) {
+        close(pipefd[0]);
+        errno = rc;
+        return -1;
+    }
+
+    int drained = drain(pipefd[0]);
+    close(pipefd[0]);
+    int status;
+    while (wait4(pid, &status, 0, ru) < 0) {
+        if (errno != EINTR) return -1;
+    }
+    *wall_ns = now_ns() - start;
+    return drained == 0 ? status : -1;
+}
+
+static void usage(void) {
+    fprintf(stderr, "usage: launcher -i INPUT -o OUTPUT [-w WARMUP] [-n RUNS] -- PROGRAM [ARGS...]\n");
+}
+
+int main(int argc, char **argv) {
+    const char *input = NULL, *output = NULL;
+    long warmup = 0, runs = 1;
+    int opt;
+    while ((opt = getopt(argc, argv, "i:o:w:n:")) != -1) {
+        switch (opt) {
+        case 'i': input = optarg; break;
+        case 'o': output = optarg; break;
+        case 'w': warmup = strtol(optarg, NULL, 10); break;
+        case 'n': runs = strtol(optarg, NULL, 10); break;
+        default: usage(); return 2;
+        }
+    }
+    if (!input || !output || optind >= argc || warmup < 0 || runs < 1) {
+        usage();
+        return 2;
+    }
+    char **prog = argv + optind;
+
+    int in_fd = open(input, O_RDONLY);
+    if (in_fd < 0) {
+        perror(input);
+        return 2;
+    }
+    cloexec(in_fd);
+
+    for (long i = 0; i < warmup + runs; i++) {
+        int64_t wall_ns;
+        struct rusage ru;
+        int status = run_once(prog, in_fd, &wall_ns, &ru);
+        if (status < 0) {
+            perror(prog[0]);
+            return 2;
+        }
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+            fprintf(stderr, "launcher: %s failed (wait status %d)\n", prog[0], status);
+            return 2;
+        }
+        if (i >= warmup) {
+            printf("BENCH_LAUNCH wall_ns=%lld user_ns=%lld sys_ns=%lld minflt=%ld majflt=%ld\n",
+                   (long long)wall_ns, (long long)tv_ns(ru.ru_utime), (long long)tv_ns(ru.ru_stime),
+                   ru.ru_minflt, ru.ru_majflt);
+        }
+    }
+
+    FILE *out = fopen(output, "wb");
+    if (!out || fwrite(buf, 1, buf_len, out) != buf_len || fclose(out) != 0) {
+        perror(output);
+        return 2;
+    }
+    free(buf);
+    close(in_fd);
+    return 0;
+}